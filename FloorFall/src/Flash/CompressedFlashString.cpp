@@ -0,0 +1,59 @@
+#include "CompressedFlashString.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For pgm_read_byte
+#include <avr/pgmspace.h>
+
+namespace
+{
+	size_t getCodeLength(uint8_t code, const uint8_t * dictionary)
+	{
+		size_t length = 0;
+
+		// The same walk as 'writeCompressedCode', counting instead of writing.
+		while(code >= StringCodec::firstPairCode)
+		{
+			const uint8_t * pair = &dictionary[(code - StringCodec::firstPairCode) * 2];
+
+			length += getCodeLength(pgm_read_byte(&pair[0]), dictionary);
+			code = pgm_read_byte(&pair[1]);
+		}
+
+		return (length + 1);
+	}
+}
+
+size_t printCompressedFlashString(Print & print, const uint8_t * codes, uint8_t codeCount, const uint8_t * dictionary)
+{
+	size_t count = 0;
+
+	for(uint8_t index = 0; index < codeCount; ++index)
+		count += writeCompressedCode(print, pgm_read_byte(&codes[index]), dictionary);
+
+	return count;
+}
+
+size_t getCompressedFlashStringLength(const uint8_t * codes, uint8_t codeCount, const uint8_t * dictionary)
+{
+	size_t length = 0;
+
+	for(uint8_t index = 0; index < codeCount; ++index)
+		length += getCodeLength(pgm_read_byte(&codes[index]), dictionary);
+
+	return length;
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+// For Print
+#include <Print.h>
+
+// For pgm_read_byte
+#include <avr/pgmspace.h>
+
+#include "../Strings/StringCodec.h"
+
+// Writes the characters that a single code stands for to 'output',
+// which can be anything with a 'write(uint8_t)' like 'Print's.
+// Returns the number of characters written.
+template<typename Output>
+size_t writeCompressedCode(Output & output, uint8_t code, const uint8_t * dictionary)
+{
+	size_t count = 0;
+
+	// Expand pairs until only a character is left.
+	// The first code of each pair recurses,
+	// but the second just carries on around the loop.
+	while(code >= StringCodec::firstPairCode)
+	{
+		const uint8_t * pair = &dictionary[(code - StringCodec::firstPairCode) * 2];
+
+		count += writeCompressedCode(output, pgm_read_byte(&pair[0]), dictionary);
+		code = pgm_read_byte(&pair[1]);
+	}
+
+	return (count + output.write(code));
+}
+
+// Prints a string compressed in the format described by 'StringCodec',
+// decoding it a character at a time straight into 'print'.
+// Returns the number of characters printed.
+size_t printCompressedFlashString(Print & print, const uint8_t * codes, uint8_t codeCount, const uint8_t * dictionary);
+
+// Returns the number of characters a compressed string stands for,
+// without printing anything.
+size_t getCompressedFlashStringLength(const uint8_t * codes, uint8_t codeCount, const uint8_t * dictionary);
+
+// A string compressed with a dictionary, all stored in progmem.
+//
+// Unlike 'FlashString', the number of codes is kept alongside them,
+// so there's no terminator taking up space.
+// The string is never copied into RAM, not even a character at a time into a buffer;
+// 'printTo' decodes it straight into a 'Print'.
+class CompressedFlashString
+{
+public:
+	// Provide C++ standard library style type aliases.
+	using value_type = char;
+	using size_type = size_t;
+
+private:
+	const uint8_t * codes;
+	const uint8_t * dictionary;
+	uint8_t codeCount;
+
+public:
+	// For constructing from some codes and the dictionary they use.
+	// These are usually found in the 'StringTable' by 'getString'.
+	constexpr CompressedFlashString(const uint8_t * codes, uint8_t codeCount, const uint8_t * dictionary) :
+		codes { codes },
+		dictionary { dictionary },
+		codeCount { codeCount }
+	{
+	}
+
+	// Match C++ standard library convention.
+	// (This has to decode the string, so it's best cached if it's needed more than once.)
+	size_type size() const
+	{
+		return getCompressedFlashStringLength(this->codes, this->codeCount, this->dictionary);
+	}
+
+	// The number of bytes of codes the string takes up.
+	constexpr uint8_t getCodeCount() const
+	{
+		return this->codeCount;
+	}
+
+	// Prints the string, decoding it along the way.
+	// Returns the number of characters printed.
+	size_t printTo(Print & print) const
+	{
+		return printCompressedFlashString(print, this->codes, this->codeCount, this->dictionary);
+	}
+
+	// Decodes the string straight into 'output', as with 'printTo',
+	// but 'output' can be anything with a 'write(uint8_t)' like 'Print's.
+	// If its 'write' can't be overridden (as with 'Canvas'),
+	// each character is written without a virtual call.
+	template<typename Output>
+	size_t writeTo(Output & output) const
+	{
+		size_t count = 0;
+
+		for(uint8_t index = 0; index < this->codeCount; ++index)
+			count += writeCompressedCode(output, pgm_read_byte(&this->codes[index]), this->dictionary);
+
+		return count;
+	}
+};
\ No newline at end of file
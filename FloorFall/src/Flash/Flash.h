@@ -17,4 +17,5 @@
 #include "FlashStringHelper.h"
 #include "FlashCharPointer.h"
 #include "FlashString.h"
-#include "KnownSizeFlashString.h"
\ No newline at end of file
+#include "KnownSizeFlashString.h"
+#include "CompressedFlashString.h"
\ No newline at end of file
@@ -16,26 +16,106 @@
 //  limitations under the License.
 //
 
-#include "Levels.h"
+#include "Profiling.h"
+#include "Settings.h"
 
 void Game::setup()
 {
+	// Before anything else has a chance to use the stack.
+	FrameMonitor::paintStack();
+
+	#if defined(FLOORFALL_STREAMING_RENDERER)
+	// 'begin' would draw Arduboy2's logo into the screen buffer,
+	// so everything else that it does is done here instead.
+	this->arduboy.boot();
+	this->arduboy.flashlight();
+	this->arduboy.systemButtons();
+	this->arduboy.waitNoButtons();
+	#else
 	this->arduboy.begin();
-	this->gameData.loadMap(Levels::level0);
+	#endif
+
+	// Carry on from where the player left off.
+	this->gameData.getSaveData().load();
+	this->levelSelectState.setSelectedIndex(this->gameData.getSaveData().getSelectedIndex());
 }
 
 void Game::loop()
 {
+	// Watch the buttons even while waiting for the next frame,
+	// so that presses too quick for a frame to see still count.
+	this->input.sample(Arduboy2Base::buttonsState());
+
+	// Fast-forwarding doesn't wait for the next frame,
+	// and doesn't draw anything until it's finished.
+	if(this->fastForwarding)
+	{
+		Profiler::enter(ProfileSection::Frame);
+
+		this->update();
+
+		Profiler::enter(ProfileSection::Idle);
+		return;
+	}
+
 	if(!this->arduboy.nextFrame())
 		return;
 
+	Profiler::enter(ProfileSection::Frame);
+	FrameMonitor::beginFrame(this->gameState);
+
 	this->arduboy.pollButtons();
 
-	this->arduboy.clear();
+	this->input.updateRepeat(this->getRepeatingButtons(), Settings::inputRepeatDelay, Settings::inputRepeatInterval);
+
+	// The overlay's chord is handled before the states see the buttons,
+	// and belongs to the overlay alone: the states don't update that frame,
+	// and the press of Down it queued is thrown away rather than moving the player.
+	if(FrameMonitor::updateOverlay(this->arduboy))
+	{
+		this->input.clear();
+		this->requestRedraw();
+	}
+	else
+	{
+		FrameMonitor::enter(FramePhase::Update);
+
+		this->update();
+	}
+
+	// If nothing on screen has changed, there's nothing to draw or to send,
+	// and the rest of the frame is spent asleep in 'nextFrame'.
+	if(this->shouldRender())
+	{
+		FrameMonitor::enter(FramePhase::Render);
+
+		#if defined(FLOORFALL_STREAMING_RENDERER)
+		// Each page is sent as soon as it's drawn,
+		// so there's no telling rendering and sending apart.
+		this->streamScreen();
+		#else
+		this->prepareScreen();
+
+		this->render();
+
+		FrameMonitor::enter(FramePhase::Display);
+
+		this->arduboy.display();
+		#endif
+	}
+
+	FrameMonitor::endFrame();
+	Profiler::enter(ProfileSection::Idle);
+}
 
-	this->update();
+bool Game::startReplay(ReplayMode mode)
+{
+	if(!this->gameplayState.startReplay(*this, mode))
+		return false;
+
+	this->changeState(GameState::GameplayState);
 
-	this->arduboy.display();
+	return true;
 }
 
 void Game::update()
@@ -43,23 +123,137 @@ void Game::update()
 	switch(this->gameState)
 	{
 		case GameState::SplashscreenState:
+			Profiler::enter(ProfileSection::SplashscreenUpdate);
 			this->splashscreenState.update(*this);
-			this->splashscreenState.render(*this);
 			break;
 
 		case GameState::TitlescreenState:
+			Profiler::enter(ProfileSection::TitlescreenUpdate);
 			this->titlescreenState.update(*this);
-			this->titlescreenState.render(*this);
 			break;
 
 		case GameState::LevelSelectState:
+			Profiler::enter(ProfileSection::LevelSelectUpdate);
 			this->levelSelectState.update(*this);
-			this->levelSelectState.render(*this);
 			break;
 
 		case GameState::GameplayState:
+			Profiler::enter(ProfileSection::GameplayUpdate);
 			this->gameplayState.update(*this);
+			break;
+	}
+
+	Profiler::enter(ProfileSection::Frame);
+}
+
+bool Game::shouldRender() const
+{
+	return (!Settings::useRenderOnChange || this->redrawRequested || this->renderRequested || FrameMonitor::isOverlayVisible());
+}
+
+void Game::render()
+{
+	// Note that if the state changed during the update,
+	// this renders the new state rather than the old one.
+	switch(this->gameState)
+	{
+		case GameState::SplashscreenState:
+			Profiler::enter(ProfileSection::SplashscreenRender);
+			this->splashscreenState.render(*this);
+			break;
+
+		case GameState::TitlescreenState:
+			Profiler::enter(ProfileSection::TitlescreenRender);
+			this->titlescreenState.render(*this);
+			break;
+
+		case GameState::LevelSelectState:
+			Profiler::enter(ProfileSection::LevelSelectRender);
+			this->levelSelectState.render(*this);
+			break;
+
+		case GameState::GameplayState:
+			Profiler::enter(ProfileSection::GameplayRender);
 			this->gameplayState.render(*this);
 			break;
 	}
-}
\ No newline at end of file
+
+	Profiler::enter(ProfileSection::Frame);
+
+	// The overlay goes over whatever the state drew.
+	FrameMonitor::renderOverlay(this->canvas);
+}
+
+uint8_t Game::getRepeatingButtons() const
+{
+	switch(this->gameState)
+	{
+		// Holding a direction keeps walking.
+		case GameState::GameplayState:
+			return (LEFT_BUTTON | RIGHT_BUTTON | UP_BUTTON | DOWN_BUTTON);
+
+		// Holding up or down scrolls through the list.
+		case GameState::LevelSelectState:
+			return (UP_BUTTON | DOWN_BUTTON);
+
+		default:
+			return 0;
+	}
+}
+
+#if defined(FLOORFALL_STREAMING_RENDERER)
+
+void Game::streamScreen()
+{
+	// Every page is composed from nothing,
+	// so as far as the states are concerned
+	// the whole screen is redrawn every frame.
+	this->redrawing = true;
+	this->redrawRequested = false;
+	this->renderRequested = false;
+	this->streaming = true;
+
+	// The only screen memory needed is a single page.
+	uint8_t page[WIDTH];
+
+	for(uint8_t index = 0; index < Canvas::screenPages; ++index)
+	{
+		this->canvas = Canvas(page, index, 1);
+		this->canvas.clear();
+
+		this->render();
+
+		// The display moves along by itself after each byte,
+		// and wraps around after the last page,
+		// so sending exactly one screen's worth of bytes per frame
+		// keeps it in step, just as 'display' does.
+		for(uint8_t column = 0; column < WIDTH; ++column)
+			Arduboy2Core::paint8Pixels(page[column]);
+	}
+
+	// The page is about to go out of scope.
+	this->canvas = Canvas();
+	this->streaming = false;
+}
+
+#else
+
+void Game::prepareScreen()
+{
+	this->renderRequested = false;
+
+	// Redraw everything if asked to,
+	// or every frame if dirty rendering is turned off.
+	this->redrawing = (this->redrawRequested || !Settings::useDirtyRendering);
+	this->redrawRequested = false;
+
+	if(this->redrawing)
+	{
+		this->arduboy.clear();
+
+		// The board has been wiped along with everything else.
+		this->gameData.markAllTilesDirty();
+	}
+}
+
+#endif
\ No newline at end of file
@@ -21,11 +21,23 @@
 #include "Strings.h"
 #include "States.h"
 #include "GameData.h"
+#include "Input.h"
+#include "Rendering/Canvas.h"
 
 class Game
 {
+public:
+	// A streaming build never uses the screen buffer, so it's left out of the build,
+	// but Arduboy2's text functions draw into it, and even an unused 'Print' override
+	// would keep it in, so a streaming build makes do with Arduboy2Base.
+	#if defined(FLOORFALL_STREAMING_RENDERER)
+	using Arduboy = Arduboy2Base;
+	#else
+	using Arduboy = Arduboy2;
+	#endif
+
 private:
-	Arduboy2 arduboy {};
+	Arduboy arduboy {};
 
 	GameState gameState { GameState::SplashscreenState };
 
@@ -36,22 +48,119 @@ private:
 
 	GameData gameData {};
 
+	// The presses of the d-pad that the states haven't handled yet.
+	InputQueue input {};
+
+	// Set when something has asked for the whole screen to be redrawn.
+	bool redrawRequested { true };
+
+	// Whether the whole screen is being redrawn this frame.
+	bool redrawing { true };
+
+	// Set when something on screen has changed,
+	// but not so much that the whole screen needs redrawing.
+	bool renderRequested { false };
+
+	// What the states draw into.
+	// Usually this covers Arduboy2's whole screen buffer,
+	// but in a streaming build it only ever covers the page being streamed.
+	#if defined(FLOORFALL_STREAMING_RENDERER)
+	Canvas canvas {};
+	#else
+	Canvas canvas { Arduboy2Base::getBuffer(), 0, Canvas::screenPages };
+	#endif
+
+	// Whether the screen is being streamed a page at a time this frame.
+	bool streaming { false };
+
+	// Whether a replay is being fast-forwarded,
+	// in which case the game updates as fast as it can without drawing anything.
+	bool fastForwarding { false };
+
 public:
 	void changeState(GameState gameState)
 	{
+		// This is the only time progress is saved,
+		// since a state change is when a dropped frame is least noticeable.
+		this->gameData.getSaveData().save();
+
 		this->gameState = gameState;
+
+		// Presses meant for the old state shouldn't carry over to the new one.
+		this->input.clear();
+
+		// A new state means a new screen.
+		this->requestRedraw();
 	}
 
-	Arduboy2 & getArduboy()
+	// Asks for the whole screen to be cleared and redrawn.
+	// If the screen hasn't been drawn yet this frame, it happens this frame,
+	// otherwise it happens next frame.
+	void requestRedraw()
+	{
+		this->redrawRequested = true;
+	}
+
+	// Asks for the screen to be rendered and sent to the display this frame,
+	// without clearing it first.
+	// A state that only draws what has changed asks for this when something has,
+	// since a frame in which nothing has changed may not be rendered at all.
+	void requestRender()
+	{
+		this->renderRequested = true;
+	}
+
+	// Determines whether the whole screen is being redrawn this frame.
+	// If not, the screen still holds whatever was drawn last frame.
+	bool isRedrawing() const
+	{
+		return this->redrawing;
+	}
+
+	// Determines whether the screen is being streamed a page at a time.
+	// If so, the current state is rendered once per page,
+	// each time onto a blank canvas that only covers that page.
+	bool isStreaming() const
+	{
+		return this->streaming;
+	}
+
+	// Determines whether a replay is being fast-forwarded.
+	bool isFastForwarding() const
+	{
+		return this->fastForwarding;
+	}
+
+	// Starts or stops fast-forwarding.
+	// Stopping redraws the screen, which hasn't kept up.
+	void setFastForwarding(bool fastForwarding)
+	{
+		if(this->fastForwarding && !fastForwarding)
+			this->requestRedraw();
+
+		this->fastForwarding = fastForwarding;
+	}
+
+	Canvas & getCanvas()
+	{
+		return this->canvas;
+	}
+
+	Arduboy & getArduboy()
 	{
 		return this->arduboy;
 	}
 
-	const Arduboy2 & getArduboy() const
+	const Arduboy & getArduboy() const
 	{
 		return this->arduboy;
 	}
 
+	InputQueue & getInput()
+	{
+		return this->input;
+	}
+
 	GameData & getGameData()
 	{
 		return this->gameData;
@@ -62,11 +171,39 @@ public:
 		return this->gameData;
 	}
 
+	// Finds one of the strings in the language the player picked.
+	CompressedFlashString getString(StringId id) const
+	{
+		return ::getString(this->gameData.getSaveData().getLanguage(), id);
+	}
+
 public:
 	void setup();
 
 	void loop();
 
+	// Plays back the game data's replay.
+	// Returns false if it can't be played back on this build of the game.
+	bool startReplay(ReplayMode mode);
+
 private:
 	void update();
+
+	// Determines whether anything on screen has changed this frame,
+	// and so whether it needs rendering and sending to the display.
+	bool shouldRender() const;
+
+	void render();
+
+	// Returns the buttons that repeat when held in the current state.
+	uint8_t getRepeatingButtons() const;
+
+	#if defined(FLOORFALL_STREAMING_RENDERER)
+	// Renders the current state one page at a time,
+	// sending each page to the display as soon as it's finished.
+	void streamScreen();
+	#else
+	// Clears the screen, if it needs to be redrawn.
+	void prepareScreen();
+	#endif
 };
\ No newline at end of file
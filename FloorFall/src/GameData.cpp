@@ -1,22 +1,20 @@
 #include "GameData.h"
 
 #include "Logic.h"
-#include "Images.h"
+#include "Levels.h"
 #include "Utils.h"
-
-// Include Arduboy2 for Sprites.
-#include <Arduboy2.h>
+#include "Rendering.h"
 
 // Include progmem reading funtions for map loading.
 #include <avr/pgmspace.h>
 
-void GameData::renderBoard() const
+void GameData::renderBoard(Canvas & canvas) const
 {
 	// Forward to the offset version.
-	this->renderBoard(0, 0);
+	this->renderBoard(canvas, 0, 0);
 }
 
-void GameData::renderBoard(int16_t xOffset, int16_t yOffset) const
+void GameData::renderBoard(Canvas & canvas, int16_t xOffset, int16_t yOffset) const
 {
 	// These checks are left in as a precaution.
 	// I certainly have no intent of using such a large board,
@@ -29,142 +27,339 @@ void GameData::renderBoard(int16_t xOffset, int16_t yOffset) const
 	// produce warnings about comparing signed and unsigned numbers,
 	// because size_t (Board's size_type) will always be unsigned.
 
-	for(uint8_t y = 0; y < this->board.getHeight(); ++y)
+	// Only the tiles of the map that the camera can see are drawn.
+	// Everything else is empty, and the screen starts out blank.
+	const uint8_t endX = Utils::minimum(this->mapWidth, static_cast<uint8_t>(this->cameraX + viewWidth));
+	const uint8_t endY = Utils::minimum(this->mapHeight, static_cast<uint8_t>(this->cameraY + viewHeight));
+
+	for(uint8_t y = this->cameraY; y < endY; ++y)
 	{
 		// Calculate the y position of the tile
-		const int16_t drawY = (yOffset + (y * this->getTileHeight()));
+		const int16_t drawY = (yOffset + this->getScreenY(y));
 
 		// Note that both y and tileHeight are automatically
 		// promoted to int before the multiplication,
 		// so the multiplication is 16-bit on Arduboy
 		// and thus there's no need to worry about overflow.
 
-		for(uint8_t x = 0; x < this->board.getWidth(); ++x)
+		// Skip rows that the canvas doesn't cover.
+		if(!canvas.coversRows(drawY, this->getTileHeight()))
+			continue;
+
+		for(uint8_t x = this->cameraX; x < endX; ++x)
 		{
 			// Calculte the x position of the tile
-			const int16_t drawX = (xOffset + (x * this->getTileWidth()));
+			const int16_t drawX = (xOffset + this->getScreenX(x));
 
-			// Get a readonly reference to the tile
-			const auto & tile = this->board.getCell(x, y);
+			// Get a copy of the tile.
+			// (A 'BitBoard' can only provide its tiles by value.)
+			const Tile tile = this->board.getCell(x, y);
 
 			// Draw the tile
-			this->renderTile(tile, drawX, drawY);
+			this->renderTile(canvas, tile, drawX, drawY);
 		}
 	}
 }
 
-void GameData::renderTile(Tile tile, int16_t x, int16_t y) const
+void GameData::renderTile(Canvas & canvas, Tile tile, int16_t x, int16_t y) const
 {
-	// Cache the type and the parameter.
-	const auto type = tile.getType();
-	const auto parameter = tile.getParameter();
+	static_assert((tileWidth == TileRenderer::tileWidth) && (tileHeight == TileRenderer::tileHeight), "The board's tiles must match TileRenderer's");
 
-	// Used to track the sprite to be drawn.
-	const uint8_t * sprite = nullptr;
+	// Draw the tile, using the tile's parameter as the frame index.
+	TileRenderer::drawTile(canvas, tile, x, y);
+}
 
-	// Select a sprite depending on the type of the tile.
-	switch(type)
+void GameData::renderDirtyTiles(Canvas & canvas)
+{
+	// The dirty rows are in screen coordinates,
+	// and only tiles inside the map are drawn.
+	const uint8_t viewEndX = Utils::minimum(static_cast<uint8_t>(this->mapWidth - this->cameraX), viewWidth);
+	const uint8_t viewEndY = Utils::minimum(static_cast<uint8_t>(this->mapHeight - this->cameraY), viewHeight);
+
+	for(uint8_t viewY = 0; viewY < viewHeight; ++viewY)
 	{
-		case TileType::Broken:
-			sprite = Images::brokenTile;
-			break;
+		const uint16_t dirtyRow = this->dirtyRows[viewY];
+
+		// Every row is forgotten, including those below the map,
+		// which 'markAllTilesDirty' marks too.
+		// Otherwise they'd stay dirty, and the screen would be rendered every frame.
+		this->dirtyRows[viewY] = 0;
 
-		case TileType::Solid:
-			sprite = Images::solidTile;
-			break;
+		// Skip rows where nothing has changed, and rows below the map.
+		if((dirtyRow == 0) || (viewY >= viewEndY))
+			continue;
 
-		case TileType::Button:
-			sprite = Images::buttonTile;
-			break;
+		const int16_t drawY = (viewY * this->getTileHeight());
+
+		for(uint8_t viewX = 0; viewX < viewEndX; ++viewX)
+		{
+			// Skip tiles that haven't changed.
+			if((dirtyRow & (1u << viewX)) == 0)
+				continue;
+
+			const int16_t drawX = (viewX * this->getTileWidth());
+
+			// Every kind of tile is drawn opaquely,
+			// so this fully replaces whatever was drawn before.
+			this->renderTile(canvas, this->board.getCell(this->cameraX + viewX, this->cameraY + viewY), drawX, drawY);
+		}
 	}
+}
+
+void GameData::startAnimation(uint8_t x, uint8_t y, TileAnimationType type)
+{
+	// If there's no room, and the tile isn't already animating,
+	// cut one of the other animations short.
+	if(this->animations.isFull() && (this->animations.find(x, y) == this->animations.getCount()))
+	{
+		const auto & animation = this->animations[0];
+
+		// Its tile goes back to being drawn as usual.
+		this->markTileDirty(animation.x, animation.y);
+
+		this->animations.remove(0);
+	}
+
+	this->animations.start(x, y, type, TileRenderer::getAnimationFrameDuration(type));
+
+	// The first frame needs drawing.
+	this->markTileDirty(x, y);
+}
+
+void GameData::stopAnimation(uint8_t x, uint8_t y)
+{
+	const uint8_t index = this->animations.find(x, y);
+
+	if(index == this->animations.getCount())
+		return;
+
+	this->animations.remove(index);
 
-	// If sprite is no longer nullptr...
-	// (I.e. if a suitable sprite was found for the tile.)
-	if(sprite != nullptr)
-		// Draw the sprite, using the tile's parameter as the frame index.
-		Sprites::drawOverwrite(x, y, sprite, parameter);
+	// The tile goes back to being drawn as usual.
+	this->markTileDirty(x, y);
+}
+
+void GameData::updateAnimations()
+{
+	// Only the tiles that are animating are visited,
+	// so this costs nothing when nothing is animating.
+	uint8_t index = 0;
+
+	while(index < this->animations.getCount())
+	{
+		auto & animation = this->animations[index];
+
+		// If the current frame has more time left, wait.
+		if(animation.timer > 1)
+		{
+			--animation.timer;
+			++index;
+			continue;
+		}
+
+		// Either the next frame or the tile itself needs drawing.
+		this->markTileDirty(animation.x, animation.y);
+
+		++animation.frame;
+
+		// If that was the last frame, the animation is over.
+		// (Removing it moves the last animation into its place,
+		// so the index stays where it is.)
+		if(animation.frame >= TileRenderer::getAnimationFrameCount(animation.type))
+		{
+			this->animations.remove(index);
+			continue;
+		}
+
+		animation.timer = TileRenderer::getAnimationFrameDuration(animation.type);
+		++index;
+	}
+}
+
+void GameData::renderAnimations(Canvas & canvas) const
+{
+	for(uint8_t index = 0; index < this->animations.getCount(); ++index)
+	{
+		const auto & animation = this->animations[index];
+
+		// Skip animations that are off screen.
+		// (As in 'markTileDirty', one comparison rules out both sides.)
+		const uint8_t viewX = static_cast<uint8_t>(animation.x - this->cameraX);
+		const uint8_t viewY = static_cast<uint8_t>(animation.y - this->cameraY);
+
+		if((viewX >= viewWidth) || (viewY >= viewHeight))
+			continue;
+
+		const int16_t drawY = (viewY * this->getTileHeight());
+
+		// Skip animations that the canvas doesn't cover.
+		if(!canvas.coversRows(drawY, this->getTileHeight()))
+			continue;
+
+		const int16_t drawX = (viewX * this->getTileWidth());
+
+		// Every frame is drawn opaquely, so it fully replaces the tile.
+		TileRenderer::drawAnimationFrame(canvas, animation.type, animation.frame, drawX, drawY);
+	}
 }
 
 void GameData::reloadLastMap()
 {
 	// Exactly what it says on the tin.
-	this->loadMap(this->lastMap);
+	this->loadLevel(this->levelIndex);
 }
 
-void GameData::loadMap(const uint8_t * map)
+void GameData::loadLevel(uint16_t index)
+{
+	this->loadLevelMap(index);
+
+	// Start a new recording from the untouched board.
+	this->replay.begin(index, this->hashBoard());
+}
+
+bool GameData::loadReplayLevel()
+{
+	const uint16_t index = this->replay.getLevelIndex();
+
+	// The replay might have come from a different build of the game.
+	if(index >= Levels::levels.getLevelCount())
+		return false;
+
+	this->loadLevelMap(index);
+
+	return (this->hashBoard() == this->replay.getBoardHash());
+}
+
+uint16_t GameData::hashBoard() const
+{
+	// Defer to the free function.
+	return ::hashBoard(this->board, this->mapWidth, this->mapHeight, this->playerX, this->playerY);
+}
+
+bool GameData::updateCamera()
+{
+	const uint8_t cameraX = followPlayer(this->cameraX, this->playerX, this->mapWidth, viewWidth);
+	const uint8_t cameraY = followPlayer(this->cameraY, this->playerY, this->mapHeight, viewHeight);
+
+	// If the camera hasn't moved, there's nothing else to do.
+	if((cameraX == this->cameraX) && (cameraY == this->cameraY))
+		return false;
+
+	this->cameraX = cameraX;
+	this->cameraY = cameraY;
+
+	// Every tile on screen has moved.
+	this->markAllTilesDirty();
+
+	return true;
+}
+
+uint8_t GameData::followPlayer(uint8_t camera, uint8_t player, uint8_t mapSize, uint8_t viewSize)
+{
+	// A map that fits on the screen never scrolls.
+	if(mapSize <= viewSize)
+		return 0;
+
+	// If the player is too close to the near edge, bring the camera back.
+	if(player < (camera + cameraMargin))
+		camera = (player > cameraMargin) ? (player - cameraMargin) : 0;
+	// Otherwise, if the player is too close to the far edge, push the camera on.
+	else if((player + cameraMargin) >= (camera + viewSize))
+		camera = ((player + cameraMargin + 1) - viewSize);
+
+	// Don't show anything past the far edge of the map.
+	const uint8_t lastCamera = (mapSize - viewSize);
+
+	return Utils::minimum(camera, lastCamera);
+}
+
+void GameData::loadLevelMap(uint16_t index)
 {
-	// Read the map dimensions
-	const uint8_t width = pgm_read_byte(&map[0]);
-	const uint8_t height = pgm_read_byte(&map[1]);
+	// The levels are checked as the game is compiled,
+	// so there's nothing to check here besides the index.
+	constexpr auto problem = LevelPackChecks::getPackProblem(Levels::levelsContents, boardWidth, boardHeight, Board::maximumSteps);
 
+	// Create a temporary type alias.
+	using Problem = LevelPackChecks::Problem;
+
+	static_assert(problem != Problem::WrongVersion, "The level pack is from a different version of floorfall-mapc");
+	static_assert(problem != Problem::WrongLevelCount, "The level pack's tables don't match its level count");
+	static_assert(problem != Problem::WrongOffset, "A level in the pack doesn't start where its offset says");
+	static_assert(problem != Problem::WrongDimensions, "A level is empty or too big for the board");
+	static_assert(problem != Problem::PlayerOutside, "A level's player starts outside of the map");
+	static_assert(problem != Problem::WrongTiles, "A level's tiles don't fit its dimensions");
+	static_assert(problem != Problem::TooManySteps, "A level has a broken tile with more steps than the board can hold");
+	static_assert(problem != Problem::PlayerOnEmptyTile, "A level's player starts on an empty tile");
+	static_assert(problem != Problem::NoButtons, "A level has no buttons");
+	static_assert(problem != Problem::WrongInfo, "A level's info doesn't match its map");
+	static_assert(problem != Problem::Unsolvable, "A level is unsolvable");
+	static_assert(problem != Problem::TooEasy, "A level is too easy");
+	static_assert(problem != Problem::WrongPar, "A level's par can't be right");
+	static_assert(problem != Problem::WrongSize, "The level pack is the wrong size");
+	static_assert(problem == Problem::None, "The level pack is broken");
+
+	// Those only say what's wrong, so each level is checked on its own as well,
+	// so that the error names the level that's broken.
+	struct LevelChecker
+	{
+		static constexpr Problem getLevelProblem(uint16_t index, size_t map)
+		{
+			return LevelPackChecks::getLevelProblem(Levels::levelsContents, index, map, boardWidth, boardHeight, Board::maximumSteps);
+		}
+	};
+
+	static_assert(Levels::checkMainPackLevels<LevelChecker>(), "A level in the pack is broken");
+
+	// If debugging is enabled, do some extra sanity checks...
+	#if defined(DEBUG)
+	// Ensure the level exists
+	assert(index < Levels::levels.getLevelCount());
+	#endif
+
+	// Remember which level was loaded last
+	// to allow the board to be properly reset.
+	this->levelIndex = index;
+
+	// Finding a level in the pack takes the same time for any index,
+	// so there's no need to keep a pointer to the map around.
+	this->loadMap(Levels::levels.getLevel(index));
+}
+
+void GameData::loadMap(const uint8_t * map)
+{
 	// Read the player position
-	const uint8_t playerX = pgm_read_byte(&map[2]);
-	const uint8_t playerY = pgm_read_byte(&map[3]);
+	const uint8_t playerX = readMapPlayerX(map);
+	const uint8_t playerY = readMapPlayerY(map);
 
 	// If debugging is enabled, do some extra sanity checks...
 	#if defined(DEBUG)
 	// Ensure the player position is valid
-	assert(playerX < width);
-	assert(playerY < height);
+	assert(playerX < readMapWidth(map));
+	assert(playerY < readMapHeight(map));
 	#endif
 
 	// Set the player position
 	this->playerX = playerX;
 	this->playerY = playerY;
 
-	// Get a pointer to the data area of the map
-	const uint8_t * mapData = &map[4];
+	// Remember how much of the board the map covers.
+	this->mapWidth = readMapWidth(map);
+	this->mapHeight = readMapHeight(map);
 
-	// Prepare an empty tile to copy.
-	// (Oddly enough, this does actually save memory.)
-	constexpr auto emptyTile = Tile::makeEmptyTile();
+	// Load the tiles into the board.
+	loadMapTiles(this->board, map);
 
-	// Note:
-	// I tried a handful of ways of doing this,
-	// and although this probably isn't the fastest way,
-	// it's cheaper (in terms of progmem) and simpler
-	// than the other approaches I tried.
-	// On Arduboy, especially for a game like this, space trumps time.
+	// Nothing on the new board is animating.
+	this->animations.clear();
 
-	// Calculate the size of a row as stored in the map.
-	// The unusual cacluation is because the map stores two tiles per byte.
-	const auto rowSize = ((width / 2) + (((width % 2) != 0) ? 1 : 0));
+	// There's nothing to undo yet.
+	this->history.clear();
 
-	// Loop through the board.
-	for(uint8_t y = 0; y < board.getHeight(); ++y)
-	{
-		// Calculate the map offset of the row.
-		// (The compiler is probably replacing the multiplication
-		// with an addition to a variable outside the loop.)
-		const size_t rowIndex = (y * rowSize);
-		
-		for(uint8_t x = 0; x < board.getWidth(); ++x)
-		{
-			// If the tile is outside the map...
-			if((x >= width) || (y >= height))
-			{
-				// Clear the tile.
-				board.getCell(x, y) = emptyTile;
-				
-				// Continue to the next iteration.
-				continue;
-			}
+	// Start with the camera as near to the top left as it can be
+	// while keeping the player away from the edges of the screen.
+	this->cameraX = followPlayer(0, playerX, this->mapWidth, viewWidth);
+	this->cameraY = followPlayer(0, playerY, this->mapHeight, viewHeight);
 
-			// Calculate the index as an offset from the row index.
-			const size_t index = (rowIndex + (x / 2));
-
-			// Read the current byte of map data,
-			// containing two tiles worth of information.
-			const auto mapByte = pgm_read_byte(&mapData[index]);
-
-			// Set the tile.
-			board.getCell(x, y) =
-				// If x is even, read the left tile. Otherwise, read the right tile.
-				Utils::isEven(x) ? getLeftTile(mapByte) : getRightTile(mapByte);
-		}
-	}
-
-	// Remember which map was loaded last
-	// to allow the board to be properly reset.
-	this->lastMap = map;
+	// Every tile may have changed.
+	this->markAllTilesDirty();
 }
\ No newline at end of file
@@ -19,35 +19,107 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "Images.h"
 #include "Logic.h"
+#include "Saving.h"
+#include "Rendering/Canvas.h"
+#include "Rendering/TileAnimationList.h"
 
 // This data needs to be shared between multiple states.
 class GameData
 {
 private:
 	// The dimensions of the board.
+	// A bitboard is limited to 8x8, but a packed grid of 32x32 fits in 512 bytes.
+	#if defined(FLOORFALL_USE_BITBOARD)
 	static constexpr uint8_t boardWidth = 8;
 	static constexpr uint8_t boardHeight = 8;
+	#else
+	static constexpr uint8_t boardWidth = 32;
+	static constexpr uint8_t boardHeight = 32;
+	#endif
 
 	// The dimensions of each tile.
 	static constexpr uint8_t tileWidth = 8;
 	static constexpr uint8_t tileHeight = 8;
 
+	// The number of tiles that fit on the screen.
+	static constexpr uint8_t viewWidth = (WIDTH / tileWidth);
+	static constexpr uint8_t viewHeight = (HEIGHT / tileHeight);
+
+	// How close the player may come to the edge of the screen
+	// before the camera follows them, in tiles.
+	static constexpr uint8_t cameraMargin = 2;
+
+	// The number of moves that can be undone.
+	// Each takes half a byte of RAM.
+	static constexpr uint8_t historyDepth = 64;
+
 public:
+	// The two available board representations.
+	// (A 'Grid' of whole 'Tile's would need a kilobyte for a 32x32 board.)
+	using TilePackedGrid = PackedGrid<boardWidth, boardHeight>;
+	using TileBitBoard = BitBoard;
+
 	// A type alias for the type of the board.
-	using Board = Grid<Tile, boardWidth, boardHeight>;
+	// Define FLOORFALL_USE_BITBOARD to store the board as bit planes
+	// instead of as a packed grid of tiles.
+	#if defined(FLOORFALL_USE_BITBOARD)
+	using Board = TileBitBoard;
+	#else
+	using Board = TilePackedGrid;
+	#endif
+
+	static_assert(Board::maximumSteps < Images::brokenTileFrameCount, "The board can hold broken tiles with more steps than there are frames to draw them with");
+
+	// A type alias for the moves that can be undone.
+	using History = MoveHistory<historyDepth>;
 
 private:
 	// The board, represented as a grid of tiles.
 	Board board {};
 
+	// The dimensions of the map loaded onto the board.
+	// (The rest of the board is empty.)
+	uint8_t mapWidth { 0 };
+	uint8_t mapHeight { 0 };
+
 	// The player's position on the board.
 	uint8_t playerX;
 	uint8_t playerY;
 
-	// Keeps track of the last map loaded.
+	// The tile in the top left corner of the screen.
+	uint8_t cameraX { 0 };
+	uint8_t cameraY { 0 };
+
+	// Keeps track of the last level loaded.
 	// Necessary for resetting the board.
-	const uint8_t * lastMap { nullptr };
+	uint16_t levelIndex { 0 };
+
+	// The moves made since the level was loaded,
+	// or as many of them as there's room for.
+	History history {};
+
+	static_assert(sizeof(History) <= 40, "The undo history must fit in 40 bytes of RAM");
+
+	// The moves made since the level was loaded, for playing back later,
+	// or a replay that's being played back.
+	Replay replay {};
+
+	static_assert(sizeof(Replay) <= 40, "The replay must fit in 40 bytes of RAM");
+
+	// The player's progress.
+	SaveData saveData {};
+
+	// The tiles on screen that need to be redrawn.
+	// One word per row of the screen, one bit per column of the screen.
+	// (Tiles that are off screen are never drawn, so they're never dirty.)
+	uint16_t dirtyRows[viewHeight] {};
+
+	static_assert(viewWidth <= 16, "The screen must be no more than 16 tiles wide to fit a row of dirty tiles in a word");
+
+	// The tiles that are animating.
+	TileAnimationList animations {};
 
 public:
 	// Returns a mutable reference to the player's X position.
@@ -80,6 +152,71 @@ public:
 		return this->board;
 	}
 
+	// Returns a mutable reference to the move history.
+	History & getHistory()
+	{
+		return this->history;
+	}
+
+	// Returns a mutable reference to the replay.
+	Replay & getReplay()
+	{
+		return this->replay;
+	}
+
+	// Returns a read-only reference to the replay.
+	const Replay & getReplay() const
+	{
+		return this->replay;
+	}
+
+	// Returns a mutable reference to the player's progress.
+	SaveData & getSaveData()
+	{
+		return this->saveData;
+	}
+
+	// Returns a read-only reference to the player's progress.
+	const SaveData & getSaveData() const
+	{
+		return this->saveData;
+	}
+
+	// Returns the width of the map, in tiles.
+	uint8_t getMapWidth() const
+	{
+		return this->mapWidth;
+	}
+
+	// Returns the height of the map, in tiles.
+	uint8_t getMapHeight() const
+	{
+		return this->mapHeight;
+	}
+
+	// Returns the x position on screen of the left edge of a column of the board.
+	int16_t getScreenX(uint8_t x) const
+	{
+		return ((x - this->cameraX) * tileWidth);
+	}
+
+	// Returns the y position on screen of the top edge of a row of the board.
+	int16_t getScreenY(uint8_t y) const
+	{
+		return ((y - this->cameraY) * tileHeight);
+	}
+
+	// Moves the camera to keep the player on screen,
+	// at least 'cameraMargin' tiles from the edge where the map allows.
+	// Returns true if the camera moved, in which case every tile on screen is dirty.
+	bool updateCamera();
+
+	// Returns the index of the last level loaded.
+	uint16_t getLevelIndex() const
+	{
+		return this->levelIndex;
+	}
+
 	// Returns a read-only reference to the game board.
 	constexpr const Board & getBoard() const
 	{
@@ -96,57 +233,95 @@ public:
 		return tileHeight;
 	}
 
-	// Draws the board.
-	void renderBoard() const;
+	// Draws the part of the board that the camera can see.
+	void renderBoard(Canvas & canvas) const;
 
-	// Draws the board at an offset.
-	void renderBoard(int16_t x, int16_t y) const;
+	// Draws the part of the board that the camera can see, at an offset.
+	void renderBoard(Canvas & canvas, int16_t x, int16_t y) const;
 
 	// Draws a tile.
-	void renderTile(Tile tile, int16_t x, int16_t y) const;
+	void renderTile(Canvas & canvas, Tile tile, int16_t x, int16_t y) const;
 
-	// Reloads the last map loaded.
-	void reloadLastMap();
+	// Draws only the tiles that have changed since they were last drawn,
+	// then forgets that they changed.
+	void renderDirtyTiles(Canvas & canvas);
 
-	// A helper function for map loading.
-	template<size_t mapSize>
-	void loadMap(const uint8_t (& map)[mapSize]);
+	// Marks a tile as needing to be redrawn,
+	// unless it's off screen.
+	void markTileDirty(uint8_t x, uint8_t y)
+	{
+		// Find the tile's position on screen.
+		// (A tile to the left of or above the camera wraps around
+		// to a large number, so one comparison rules out both sides.)
+		const uint8_t viewX = static_cast<uint8_t>(x - this->cameraX);
+		const uint8_t viewY = static_cast<uint8_t>(y - this->cameraY);
+
+		if((viewX < viewWidth) && (viewY < viewHeight))
+			this->dirtyRows[viewY] |= static_cast<uint16_t>(1u << viewX);
+	}
+
+	// Determines whether any tile on screen needs to be redrawn.
+	bool hasDirtyTiles() const
+	{
+		for(uint8_t y = 0; y < viewHeight; ++y)
+			if(this->dirtyRows[y] != 0)
+				return true;
+
+		return false;
+	}
+
+	// Forgets which tiles need to be redrawn,
+	// for when the whole board has been drawn anyway.
+	void clearDirtyTiles()
+	{
+		for(uint8_t y = 0; y < viewHeight; ++y)
+			this->dirtyRows[y] = 0;
+	}
+
+	// Marks every tile on screen as needing to be redrawn.
+	void markAllTilesDirty()
+	{
+		for(uint8_t y = 0; y < viewHeight; ++y)
+			this->dirtyRows[y] = 0xFFFF;
+	}
+
+	// Starts an animation on a tile, replacing any that's already playing there.
+	// If too many tiles are animating, one of them is cut short to make room.
+	void startAnimation(uint8_t x, uint8_t y, TileAnimationType type);
+
+	// Stops the animation playing on a tile, if there is one.
+	void stopAnimation(uint8_t x, uint8_t y);
+
+	// Moves every animation on by an update,
+	// marking the tiles whose pictures have changed as dirty.
+	void updateAnimations();
+
+	// Draws the current frame of every animation that the camera can see,
+	// over the top of the tiles.
+	void renderAnimations(Canvas & canvas) const;
+
+	// Loads a level from 'Levels::levels'
+	// and starts recording a new replay.
+	void loadLevel(uint16_t index);
+
+	// Loads the level that the replay was recorded on, keeping the replay.
+	// Returns false if there's no such level,
+	// or if the board doesn't match the one the replay was recorded from.
+	bool loadReplayLevel();
+
+	// Reloads the last level loaded.
+	void reloadLastMap();
 
 	// Loads a map.
 	void loadMap(const uint8_t * map);
-};
 
-// Define the loadMap function template
-template<size_t mapSize>
-void GameData::loadMap(const uint8_t (& map)[mapSize])
-{
-	// Ensure the map has at least the required 4 byte header
-	static_assert(mapSize > 4, "A map must be at least 4 bytes large");
-
-	// If debugging is enabled, do some extra sanity checks...
-	#if defined(DEBUG)
-	// Read the map dimensions
-	const uint8_t width = pgm_read_byte(&map[0]);
-	const uint8_t height = pgm_read_byte(&map[1]);
-
-	// Ensure that the map is a suitable size
-	assert(width > 0);
-	assert(height > 0);
-	assert(width <= 8);
-	assert(height <= 8);
-
-	// Round the dimensions up to the next nearest multiple of two.
-	const uint8_t evenWidth = (width + (width & 1));
-	const uint8_t evenHeight = (height + (height & 1));
-	
-	// Calculate the expected size of the map
-	const size_t dataSize = ((evenWidth * evenHeight) / (8 / 4));
-	const size_t expectedSize = (4 + dataSize);
-
-	// Ensure that the map is the expected size
-	assert(mapSize == expectedSize);
-	#endif
+private:
+	// Loads a level from 'Levels::levels' without touching the replay.
+	void loadLevelMap(uint16_t index);
+
+	// Hashes the board as it is now, for the replay.
+	uint16_t hashBoard() const;
 
-	// Defer to the actual map loading function
-	this->loadMap(&map[0]);
-}
\ No newline at end of file
+	// Finds the camera position along one axis that keeps the player on screen.
+	static uint8_t followPlayer(uint8_t camera, uint8_t player, uint8_t mapSize, uint8_t viewSize);
+};
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t
+#include <stdint.h>
+
+// For PROGMEM
+#include <avr/pgmspace.h>
+
+namespace Images
+{
+	constexpr uint8_t arrowWidth = 8;
+	constexpr uint8_t arrowHeight = 8;
+
+	// The frames are in the same order as 'Direction'.
+	constexpr uint8_t arrow[] PROGMEM
+	{
+		// Dimensions
+		arrowWidth, arrowHeight,
+
+		// Frame 0 - Left
+		0x00, 0x18, 0x3C, 0x7E, 0x18, 0x18, 0x18, 0x00,
+
+		// Frame 1 - Right
+		0x00, 0x18, 0x18, 0x18, 0x7E, 0x3C, 0x18, 0x00,
+
+		// Frame 2 - Up
+		0x00, 0x08, 0x0C, 0x7E, 0x7E, 0x0C, 0x08, 0x00,
+
+		// Frame 3 - Down
+		0x00, 0x10, 0x30, 0x7E, 0x7E, 0x30, 0x10, 0x00,
+	};
+}
\ No newline at end of file
@@ -26,6 +26,7 @@ namespace Images
 {
 	constexpr uint8_t brokenTileWidth = 8;
 	constexpr uint8_t brokenTileHeight = 8;
+	constexpr uint8_t brokenTileFrameCount = 10;
 
 	constexpr uint8_t brokenTile[] PROGMEM
 	{
@@ -44,22 +45,59 @@ namespace Images
 		// Frame 3 - Broken Tile 3
 		0x7E, 0xFF, 0xDB, 0xBD, 0xB5, 0xB5, 0xCB, 0x7E,
 
-		// // Frame 4 - Broken Tile 4
-		// 0x7E, 0xFF, 0xCF, 0xD7, 0xDB, 0x83, 0xDF, 0x7E,
+		// Frame 4 - Broken Tile 4
+		0x7E, 0xFF, 0xCF, 0xD7, 0xDB, 0x83, 0xDF, 0x7E,
 
-		// // Frame 5 - Broken Tile 5
-		// 0x7E, 0xFF, 0xD1, 0xB5, 0xB5, 0xCD, 0xFF, 0x7E,
+		// Frame 5 - Broken Tile 5
+		0x7E, 0xFF, 0xD1, 0xB5, 0xB5, 0xCD, 0xFF, 0x7E,
 
-		// // Frame 6 - Broken Tile 6
-		// 0x7E, 0xFF, 0xC3, 0xAD, 0xAD, 0xDB, 0xFF, 0x7E,
+		// Frame 6 - Broken Tile 6
+		0x7E, 0xFF, 0xC3, 0xAD, 0xAD, 0xDB, 0xFF, 0x7E,
 
-		// // Frame 7 - Broken Tile 7
-		// 0x7E, 0xFF, 0xFD, 0x9D, 0xE5, 0xF9, 0xFF, 0x7E,
+		// Frame 7 - Broken Tile 7
+		0x7E, 0xFF, 0xFD, 0x9D, 0xE5, 0xF9, 0xFF, 0x7E,
 
-		// // Frame 8 - Broken Tile 8
-		// 0x7E, 0xFF, 0xCB, 0xB5, 0xB5, 0xCB, 0xFF, 0x7E,
+		// Frame 8 - Broken Tile 8
+		0x7E, 0xFF, 0xCB, 0xB5, 0xB5, 0xCB, 0xFF, 0x7E,
 
-		// // Frame 9 - Broken Tile 9
-		// 0x7E, 0xFF, 0xF3, 0xAD, 0xAD, 0xC3, 0xFF, 0x7E,
+		// Frame 9 - Broken Tile 9
+		0x7E, 0xFF, 0xF3, 0xAD, 0xAD, 0xC3, 0xFF, 0x7E,
+	};
+
+	// Shown while a broken tile loses a step.
+	constexpr uint8_t brokenTileCrumbleWidth = 8;
+	constexpr uint8_t brokenTileCrumbleHeight = 8;
+	constexpr uint8_t brokenTileCrumbleFrameCount = 2;
+
+	constexpr uint8_t brokenTileCrumble[] PROGMEM
+	{
+		// Dimensions
+		brokenTileCrumbleWidth, brokenTileCrumbleHeight,
+
+		// Frame 0 - Crumbling 0
+		0x7E, 0xD5, 0xAB, 0xD5, 0xAB, 0xD5, 0xAB, 0x7E,
+
+		// Frame 1 - Crumbling 1
+		0x7E, 0xAB, 0xD5, 0xAB, 0xD5, 0xAB, 0xD5, 0x7E,
+	};
+
+	// Shown while a broken tile with no steps left falls away.
+	constexpr uint8_t brokenTileFallWidth = 8;
+	constexpr uint8_t brokenTileFallHeight = 8;
+	constexpr uint8_t brokenTileFallFrameCount = 3;
+
+	constexpr uint8_t brokenTileFall[] PROGMEM
+	{
+		// Dimensions
+		brokenTileFallWidth, brokenTileFallHeight,
+
+		// Frame 0 - Falling 0
+		0x00, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x00,
+
+		// Frame 1 - Falling 1
+		0x00, 0x00, 0x3C, 0x24, 0x24, 0x3C, 0x00, 0x00,
+
+		// Frame 2 - Falling 2
+		0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
 	};
 }
\ No newline at end of file
@@ -26,6 +26,7 @@ namespace Images
 {
 	constexpr uint8_t buttonTileWidth = 8;
 	constexpr uint8_t buttonTileHeight = 8;
+	constexpr uint8_t buttonTileFrameCount = 2;
 
 	constexpr uint8_t buttonTile[] PROGMEM
 	{
@@ -38,4 +39,38 @@ namespace Images
 		// Frame 1 - On
 		0x7E, 0xC3, 0x99, 0xBD, 0xBD, 0x99, 0xC3, 0x7E,
 	};
+
+	// Shown while a button is pushed down, before it turns on.
+	constexpr uint8_t buttonTilePressWidth = 8;
+	constexpr uint8_t buttonTilePressHeight = 8;
+	constexpr uint8_t buttonTilePressFrameCount = 2;
+
+	constexpr uint8_t buttonTilePress[] PROGMEM
+	{
+		// Dimensions
+		buttonTilePressWidth, buttonTilePressHeight,
+
+		// Frame 0 - Sinking
+		0x7E, 0xC3, 0x81, 0x99, 0x99, 0x81, 0xC3, 0x7E,
+
+		// Frame 1 - Down
+		0x7E, 0xC3, 0x81, 0x81, 0x81, 0x81, 0xC3, 0x7E,
+	};
+
+	// Shown while a button is pushed down, before it turns off.
+	constexpr uint8_t buttonTileReleaseWidth = 8;
+	constexpr uint8_t buttonTileReleaseHeight = 8;
+	constexpr uint8_t buttonTileReleaseFrameCount = 2;
+
+	constexpr uint8_t buttonTileRelease[] PROGMEM
+	{
+		// Dimensions
+		buttonTileReleaseWidth, buttonTileReleaseHeight,
+
+		// Frame 0 - Down
+		0x7E, 0xC3, 0x81, 0x81, 0x81, 0x81, 0xC3, 0x7E,
+
+		// Frame 1 - Rising
+		0x7E, 0xC3, 0x81, 0x99, 0x99, 0x81, 0xC3, 0x7E,
+	};
 }
\ No newline at end of file
@@ -19,4 +19,6 @@
 #include "SolidTile.h"
 #include "ButtonTile.h"
 #include "Player.h"
-#include "PharapLogo.h"
\ No newline at end of file
+#include "PharapLogo.h"
+#include "Arrow.h"
+#include "Font.h"
\ No newline at end of file
@@ -16,6 +16,8 @@
 //  limitations under the License.
 //
 
+// Made by floorfall-imagec from PharapLogo.png, don't edit this by hand.
+
 // For uint8_t
 #include <stdint.h>
 
@@ -27,47 +29,35 @@ namespace Images
 	constexpr uint8_t pharapLogoWidth = 48;
 	constexpr uint8_t pharapLogoHeight = 48;
 
+	// Compressed from 288 bytes to 172.
+	// (Draw it with 'Canvas::drawCompressedImage'.)
 	constexpr uint8_t pharapLogo[] PROGMEM
 	{
 		// Dimensions
 		pharapLogoWidth, pharapLogoHeight,
 
-		// Frame 0
-		0x24, 0x4C, 0xFF, 0xFD, 0xFC, 0xFE, 0xFD, 0xFC,
-		0xFE, 0xFD, 0xFC, 0xFE, 0xFD, 0xFC, 0xFE, 0xFD,
-		0xFC, 0xFE, 0x7D, 0x7C, 0x3E, 0x3D, 0x3C, 0x3E,
-		0x3D, 0x3C, 0x3E, 0x3D, 0x7C, 0x7E, 0xFD, 0xFC,
-		0xFE, 0xFD, 0xFC, 0xFE, 0xFD, 0xFC, 0xFE, 0xFD,
-		0xFC, 0xFE, 0xFD, 0xFC, 0xFE, 0xFF, 0x24, 0x4C,
-		0x49, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-		0xFF, 0xFF, 0x7F, 0x1F, 0x8F, 0xE7, 0xF3, 0xF9,
-		0x7C, 0x7C, 0x7E, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF,
-		0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x7E, 0x7C, 0x7C,
-		0xF9, 0xF3, 0xE7, 0x8F, 0x1F, 0x7F, 0xFF, 0xFF,
-		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x92,
-		0x92, 0x24, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-		0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFF, 0x01, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-		0xFF, 0xFF,	0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF,
-		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x24,
-		0x24, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-		0xFF, 0xFE, 0xF8, 0xE1, 0xC7, 0x9F, 0x3E, 0x7C,
-		0xF8, 0xF8, 0xF8, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF,
-		0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8,
-		0x7C, 0x3E, 0x9F, 0xC7, 0xE1, 0xF8, 0xFE, 0xFF,
-		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x49,
-		0x49, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-		0xFC, 0x00, 0x01, 0x7F, 0x7F, 0x03, 0x03, 0x7F,
-		0x7F, 0x03, 0x03, 0x7F, 0x7F, 0x01, 0x00, 0xFC,
-		0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x92,
-		0x32, 0x24, 0xFF, 0x7F, 0x3F, 0xBF, 0x7F, 0x3F,
-		0xBF, 0x7F, 0x3F, 0xBF, 0x7F, 0x3F, 0xBF, 0x7F,
-		0x3F, 0xBF, 0x7E, 0x3E, 0xBE, 0x7E, 0x3E, 0xBE,
-		0x7E, 0x3E, 0xBE, 0x7E, 0x3E, 0xBE, 0x7F, 0x3F,
-		0xBF, 0x7F, 0x3F, 0xBF, 0x7F, 0x3F, 0xBF, 0x7F,
-		0x3F, 0xBF, 0x7F, 0x3F, 0xBF, 0xFF, 0x32, 0x24
+		// Runs
+		0x05, 0x24, 0x4C, 0xFF, 0xFD, 0xFC, 0xFE, 0xC9,
+		0x03, 0x04, 0x7D, 0x7C, 0x3E, 0x3D, 0x3C, 0xC2,
+		0x03, 0x01, 0x7C, 0x7E, 0xCC, 0x1B, 0x02, 0xFF,
+		0x24, 0x4C, 0x01, 0x49, 0x92, 0x85, 0xFF, 0x09,
+		0x7F, 0x1F, 0x8F, 0xE7, 0xF3, 0xF9, 0x7C, 0x7C,
+		0x7E, 0x7E, 0x85, 0xFF, 0x09, 0x7E, 0x7E, 0x7C,
+		0x7C, 0xF9, 0xF3, 0xE7, 0x8F, 0x1F, 0x7F, 0x85,
+		0xFF, 0x01, 0x49, 0x92, 0x01, 0x92, 0x24, 0x84,
+		0xFF, 0x02, 0x01, 0x00, 0xFE, 0xC1, 0x05, 0x82,
+		0x00, 0x00, 0x01, 0xC3, 0x11, 0xC5, 0x0C, 0x00,
+		0xFE, 0xC3, 0x11, 0x80, 0xFF, 0x01, 0x92, 0x24,
+		0x01, 0x24, 0x49, 0x84, 0xFF, 0x06, 0xFE, 0xF8,
+		0xE1, 0xC7, 0x9F, 0x3E, 0x7C, 0x81, 0xF8, 0x01,
+		0xFC, 0xFE, 0xC2, 0x11, 0x00, 0xFC, 0x81, 0xF8,
+		0x06, 0x7C, 0x3E, 0x9F, 0xC7, 0xE1, 0xF8, 0xFE,
+		0x84, 0xFF, 0x01, 0x24, 0x49, 0x01, 0x49, 0x92,
+		0x8A, 0xFF, 0x07, 0xFE, 0xFC, 0x00, 0x01, 0x7F,
+		0x7F, 0x03, 0x03, 0xC3, 0x04, 0x03, 0x01, 0x00,
+		0xFC, 0xFE, 0x8A, 0xFF, 0x01, 0x49, 0x92, 0x05,
+		0x32, 0x24, 0xFF, 0x7F, 0x3F, 0xBF, 0xC9, 0x03,
+		0x02, 0x7E, 0x3E, 0xBE, 0xC6, 0x03, 0xCC, 0x1B,
+		0x02, 0xFF, 0x32, 0x24,
 	};
 }
\ No newline at end of file
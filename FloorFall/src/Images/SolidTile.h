@@ -26,6 +26,7 @@ namespace Images
 {
 	constexpr uint8_t solidTileWidth = 8;
 	constexpr uint8_t solidTileHeight = 8;
+	constexpr uint8_t solidTileFrameCount = 1;
 
 	constexpr uint8_t solidTile[] PROGMEM
 	{
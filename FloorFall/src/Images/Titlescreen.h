@@ -16,6 +16,8 @@
 //  limitations under the License.
 //
 
+// Made by floorfall-imagec from Titlescreen.png, don't edit this by hand.
+
 // For uint8_t
 #include <stdint.h>
 
@@ -27,15 +29,27 @@ namespace Images
 	constexpr uint8_t titlescreenWidth = 102;
 	constexpr uint8_t titlescreenHeight = 30;
 
-	constexpr uint8_t titlescreen[] PROGMEM =
+	// Compressed from 408 bytes to 112.
+	// (Draw it with 'Canvas::drawCompressedImage'.)
+	constexpr uint8_t titlescreen[] PROGMEM
 	{
 		// Dimensions
 		titlescreenWidth, titlescreenHeight,
 
-		// Frame 0 - Titlescreen
-		0x00, 0x00, 0xFC, 0xFC, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x1C, 0x0C, 0x0C, 0x1C, 0xFC, 0xF8, 0x00, 0x00, 0xF8, 0xFC, 0x1C, 0x0C, 0x0C, 0x1C, 0xFC, 0xF8, 0x00, 0x00, 0xFC, 0xFC, 0x0C, 0x0C, 0x0C, 0x0C, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0xF8, 0xFC, 0x1C, 0x0C, 0x0C, 0x1C, 0xFC, 0xF8, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xC0, 0xC0, 0xE0, 0xFF, 0x7F, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xC0, 0xC0, 0xE0, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x0F, 0x3F, 0xF3, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
-		0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+		// Runs
+		0x03, 0x00, 0x00, 0xFC, 0xFC, 0x83, 0x0C, 0xC1,
+		0x0A, 0x85, 0x00, 0x07, 0xF8, 0xFC, 0x1C, 0x0C,
+		0x0C, 0x1C, 0xFC, 0xF8, 0xC9, 0x0A, 0xC3, 0x28,
+		0xC1, 0x0A, 0x87, 0x00, 0xC7, 0x3C, 0xC9, 0x28,
+		0xC7, 0x1E, 0x85, 0x00, 0x03, 0x00, 0x00, 0xFF,
+		0xFF, 0x83, 0x03, 0xC1, 0x0A, 0x83, 0xC0, 0x09,
+		0x00, 0x00, 0x7F, 0xFF, 0xE0, 0xC0, 0xC0, 0xE0,
+		0xFF, 0x7F, 0xC9, 0x0A, 0xC1, 0x28, 0x03, 0x0F,
+		0x3F, 0xF3, 0xC1, 0x89, 0x00, 0xC9, 0x3C, 0x81,
+		0x03, 0x01, 0xFF, 0xFF, 0xC9, 0x46, 0xC7, 0x0A,
+		0x01, 0x00, 0x00, 0x85, 0x0C, 0x01, 0x00, 0x00,
+		0x85, 0x30, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x9D,
+		0x00, 0xE5, 0x3C, 0x9D, 0x00, 0x85, 0x03, 0x01,
+		0x00, 0x00, 0x85, 0x0C, 0xA7, 0x00, 0xC7, 0x3C,
 	};
 }
\ No newline at end of file
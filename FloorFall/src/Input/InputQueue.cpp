@@ -0,0 +1,120 @@
+#include "InputQueue.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+void InputQueue::sample(uint8_t buttons)
+{
+	// Buttons that aren't queued are taken as they are.
+	uint8_t heldButtons = static_cast<uint8_t>(buttons & ~queuedButtons);
+
+	// Several buttons going down in the same sample is rare enough
+	// that any order will do, so just go from the lowest bit up.
+	uint8_t slot = 0;
+
+	for(uint8_t button = 1; button != 0; button = static_cast<uint8_t>(button << 1))
+	{
+		if((queuedButtons & button) == 0)
+			continue;
+
+		uint8_t & releaseSamples = this->releaseSamples[slot];
+		++slot;
+
+		// If the button is up, count towards letting go of it.
+		if((buttons & button) == 0)
+		{
+			if(releaseSamples < debounceSamples)
+			{
+				++releaseSamples;
+
+				// Until then, it's still held.
+				if(releaseSamples < debounceSamples)
+					heldButtons |= button;
+			}
+
+			continue;
+		}
+
+		heldButtons |= button;
+
+		// If the button wasn't let go of, this is just a bounce.
+		const bool wasLetGo = (releaseSamples >= debounceSamples);
+
+		releaseSamples = 0;
+
+		if(!wasLetGo)
+			continue;
+
+		this->push(button);
+
+		// The newest press is the one that may repeat.
+		// It's restarted rather than continued,
+		// so that the delay always comes before the first repeat.
+		this->repeatButton = button;
+		this->repeatTimer = 0xFF;
+	}
+
+	this->heldButtons = heldButtons;
+}
+
+void InputQueue::updateRepeat(uint8_t repeatingButtons, uint8_t delay, uint8_t interval)
+{
+	// If the button has been let go of, or isn't allowed to repeat, stop.
+	if(((this->repeatButton & this->heldButtons & repeatingButtons) == 0))
+	{
+		this->repeatButton = 0;
+		return;
+	}
+
+	// The button has only just been pressed, so start the delay.
+	if(this->repeatTimer == 0xFF)
+		this->repeatTimer = delay;
+
+	if(this->repeatTimer > 0)
+		--this->repeatTimer;
+
+	if(this->repeatTimer > 0)
+		return;
+
+	// Wait for the queue to catch up before repeating,
+	// so that a slow consumer doesn't end up with a backlog.
+	if(!this->isEmpty())
+		return;
+
+	this->push(this->repeatButton);
+	this->repeatTimer = interval;
+}
+
+uint8_t InputQueue::pop()
+{
+	const uint8_t button = this->presses[this->first];
+
+	this->first = static_cast<uint8_t>((this->first + 1) % capacity);
+	--this->count;
+
+	return button;
+}
+
+void InputQueue::push(uint8_t button)
+{
+	// If the queue is full, the press is lost.
+	// (Someone pressing that fast won't expect every press to count.)
+	if(this->count >= capacity)
+		return;
+
+	this->presses[(this->first + this->count) % capacity] = button;
+	++this->count;
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t
+#include <stdint.h>
+
+// For the button masks
+#include <Arduboy2.h>
+
+// Sits between the buttons and the states, queueing each press of the d-pad
+// so that none are lost and they're handled in the order they were made.
+//
+// 'Arduboy2::justPressed' only compares one frame's buttons with the last frame's,
+// so two directions pressed within the same frame look like one press,
+// and a tap that's over before the next frame isn't seen at all.
+// The queue can be sampled as often as the game likes (e.g. every time 'loop' runs,
+// including while waiting for the next frame) and keeps every press it sees.
+//
+// Buttons bounce for a few milliseconds as they go down and come up,
+// and sampling every millisecond or so sees every bounce.
+// So a press counts as soon as the button is seen down,
+// but the button has to be seen up for 'debounceSamples' samples in a row
+// before it's considered let go of and can be pressed again.
+// That way one press of a button can never queue two moves,
+// and there's no delay before a press is seen.
+//
+// A held button can also repeat: after it's been held for a delay,
+// another press is queued every so often, for as long as it's held.
+// Only the last button pressed repeats, and only when the queue is empty,
+// so holding a button never builds up a backlog of presses.
+class InputQueue
+{
+public:
+	// The buttons that are queued.
+	static constexpr uint8_t queuedButtons = (LEFT_BUTTON | RIGHT_BUTTON | UP_BUTTON | DOWN_BUTTON);
+
+	// The most presses the queue can hold.
+	// Any more are ignored until the queue has room.
+	static constexpr uint8_t capacity = 8;
+
+	// The samples in a row that a button must be seen up for before it's let go of.
+	// While waiting for the next frame 'loop' samples about once a millisecond,
+	// which is longer than a button takes to stop bouncing.
+	// (During a busy frame it's less often, which only makes the wait longer.)
+	static constexpr uint8_t debounceSamples = 4;
+
+	// The number of queued buttons.
+	static constexpr uint8_t queuedButtonCount = 4;
+
+private:
+	// The presses, each a single button mask, oldest first from 'first'.
+	uint8_t presses[capacity] {};
+	uint8_t first { 0 };
+	uint8_t count { 0 };
+
+	// The buttons held down as of the last sample,
+	// counting any that haven't been up for long enough to be let go of.
+	uint8_t heldButtons { 0 };
+
+	// The samples in a row that each queued button has been seen up for,
+	// up to 'debounceSamples'.
+	// Starting at 'debounceSamples' means a button held at start-up counts as a press.
+	uint8_t releaseSamples[queuedButtonCount] { debounceSamples, debounceSamples, debounceSamples, debounceSamples };
+
+	// The button that's repeating (or will once it's been held long enough),
+	// or 0 if none is.
+	uint8_t repeatButton { 0 };
+
+	// The frames until 'repeatButton' next repeats.
+	uint8_t repeatTimer { 0 };
+
+public:
+	// Determines whether there are no presses waiting.
+	bool isEmpty() const
+	{
+		return (this->count == 0);
+	}
+
+	// Reads the buttons, queueing a press for each queued button
+	// that's gone down since it was last let go of.
+	void sample(uint8_t buttons);
+
+	// Advances the repeating button by a frame.
+	// Only the buttons in 'repeatingButtons' repeat, first after 'delay' frames
+	// and then every 'interval' frames.
+	void updateRepeat(uint8_t repeatingButtons, uint8_t delay, uint8_t interval);
+
+	// Removes the oldest press and returns its button mask.
+	// The queue must not be empty.
+	uint8_t pop();
+
+	// Forgets every press that's waiting, and stops any button from repeating
+	// until it's pressed again.
+	void clear()
+	{
+		this->count = 0;
+		this->repeatButton = 0;
+	}
+
+private:
+	void push(uint8_t button);
+};
\ No newline at end of file
@@ -16,7 +16,18 @@
 //  limitations under the License.
 //
 
-enum class Language
+
+// For uint8_t
+#include <stdint.h>
+
+// The languages that the game's text comes in.
+// The player picks one on the title screen.
+// (Each one's strings are in 'FloorFall/Strings', and this order
+// has to match the order they're given to 'floorfall-stringc' in.)
+enum class Language : uint8_t
 {
 	EN_GB,
-};
\ No newline at end of file
+	NL_NL,
+};
+
+constexpr uint8_t languageCount = 2;
\ No newline at end of file
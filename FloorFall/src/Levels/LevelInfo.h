@@ -0,0 +1,66 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t
+#include <stdint.h>
+
+// Facts about a level, worked out when its pack is made
+// so that the level select can show them without decoding the map.
+struct LevelInfo
+{
+	// The value of 'par' when no solution is known.
+	static constexpr uint8_t noPar = 0xFF;
+
+	// The fewest moves a level may take.
+	// Anything less is hardly a puzzle.
+	static constexpr uint8_t minimumPar = 2;
+
+	// The largest map that the solvers can handle (see 'BitBoard').
+	// A bigger level can't be given a par, so it's allowed to go without.
+	static constexpr uint8_t maximumSolvedWidth = 8;
+	static constexpr uint8_t maximumSolvedHeight = 8;
+
+	// The dimensions of the map, in tiles.
+	uint8_t width;
+	uint8_t height;
+
+	// The number of button tiles.
+	uint8_t buttonCount;
+
+	// The number of broken tiles that can still be stepped on.
+	uint8_t brokenCount;
+
+	// The fewest moves that complete the level, or 'noPar'.
+	// (A pack with unsolvable levels won't compile, see 'LevelPackChecks',
+	// so 'noPar' means the level is too big to solve.)
+	uint8_t par;
+};
+
+// Each level also has a thumbnail: the map drawn with each tile as 2x2 pixels,
+// in two pages of 16 columns each, as 'Canvas::drawFrame' draws them.
+// (A map bigger than 8x8 is shrunk to fit, so it only shows the map's shape.)
+namespace LevelThumbnail
+{
+	constexpr uint8_t tileSize = 2;
+
+	constexpr uint8_t width = 16;
+	constexpr uint8_t height = 16;
+
+	constexpr uint8_t pageCount = (height / 8);
+	constexpr uint8_t size = (width * pageCount);
+}
\ No newline at end of file
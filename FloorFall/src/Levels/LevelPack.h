@@ -0,0 +1,101 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For pgm_read_byte and memcpy_P
+#include <avr/pgmspace.h>
+
+#include "LevelInfo.h"
+
+// A level pack is a single block of progmem holding any number of maps:
+// - Format version (1 byte)
+// - Level count (2 bytes, least significant byte first)
+// - For each level, where its map starts,
+//   counted in bytes from the start of the pack (2 bytes, least significant byte first)
+// - The maps themselves, one after another,
+//   in the format described in 'Logic/MapLoading.h'
+//
+// Alongside that are two tables with an entry per level:
+// a 'LevelInfo' and a thumbnail (see 'LevelInfo.h').
+//
+// Packs are made by 'floorfall-mapc --pack' from map files.
+class LevelPack
+{
+public:
+	// The version of the format described above.
+	static constexpr uint8_t formatVersion = 1;
+
+	static constexpr uint8_t headerSize = 3;
+	static constexpr uint8_t offsetSize = 2;
+
+private:
+	const uint8_t * data;
+	const LevelInfo * info;
+	const uint8_t * thumbnails;
+
+public:
+	constexpr LevelPack(const uint8_t * data, const LevelInfo * info, const uint8_t * thumbnails) :
+		data { data }, info { info }, thumbnails { thumbnails }
+	{
+	}
+
+	uint8_t getFormatVersion() const
+	{
+		return pgm_read_byte(&this->data[0]);
+	}
+
+	uint16_t getLevelCount() const
+	{
+		return readWord(&this->data[1]);
+	}
+
+	// Gets the map of a level.
+	// The index must be less than 'getLevelCount()'.
+	const uint8_t * getLevel(uint16_t index) const
+	{
+		const uint16_t offset = readWord(&this->data[headerSize + (index * offsetSize)]);
+		return &this->data[offset];
+	}
+
+	// Reads the facts about a level.
+	// The index must be less than 'getLevelCount()'.
+	LevelInfo getLevelInfo(uint16_t index) const
+	{
+		LevelInfo result;
+		memcpy_P(&result, &this->info[index], sizeof(LevelInfo));
+		return result;
+	}
+
+	// Gets the thumbnail of a level.
+	// The index must be less than 'getLevelCount()'.
+	const uint8_t * getThumbnail(uint16_t index) const
+	{
+		return &this->thumbnails[index * LevelThumbnail::size];
+	}
+
+private:
+	// Reads two bytes, least significant first.
+	// (They needn't be aligned.)
+	static uint16_t readWord(const uint8_t * address)
+	{
+		return static_cast<uint16_t>(pgm_read_byte(&address[0]) | (pgm_read_byte(&address[1]) << 8));
+	}
+};
\ No newline at end of file
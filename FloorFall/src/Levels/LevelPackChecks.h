@@ -0,0 +1,375 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For size_t
+#include <stddef.h>
+
+#include "../Logic/BitBoard.h"
+#include "../Logic/MapLoading.h"
+#include "../Logic/Tile.h"
+
+#include "LevelInfo.h"
+#include "LevelPack.h"
+
+// Checks that a level pack is well formed while the game is being compiled,
+// so that a broken level can't make it onto an Arduboy
+// and the game needn't check anything at runtime.
+//
+// Nothing here solves a level, which would take far too long in a constant expression.
+// The checks for a level being unsolvable or too easy go by the par
+// that floorfall-mapc's solver recorded in the level's 'LevelInfo'.
+// That par is checked against the fewest moves the level could possibly be won in,
+// and against the parity that a win must have, so most mistakes made by hand are caught,
+// but a par that's too high (or one for a level that can't be won at all) can still get through.
+//
+// Everything here is constexpr, for use with 'static_assert'.
+// C++11 only allows a constexpr function a single return statement,
+// hence all of the recursion.
+// (The compiler gives up after 512 nested calls by default,
+// which is enough for a few hundred levels,
+// or a map of a few hundred codes. A large map with little repetition
+// may need a bigger limit, e.g. '-fconstexpr-depth=2048'.)
+namespace LevelPackChecks
+{
+	// The first thing found wrong with a pack.
+	enum class Problem : uint8_t
+	{
+		None,
+
+		// The format version isn't 'LevelPack::formatVersion'.
+		WrongVersion,
+
+		// The tables don't have an entry for every level.
+		WrongLevelCount,
+
+		// A level doesn't start straight after the one before it.
+		WrongOffset,
+
+		// A map is empty, or too big for the board.
+		WrongDimensions,
+
+		// The player starts outside of the map.
+		PlayerOutside,
+
+		// The tiles run past the end of a map.
+		WrongTiles,
+
+		// A broken tile has more steps than the board can hold,
+		// or than there are frames to draw it with (see 'Tile::maximumSteps').
+		TooManySteps,
+
+		// The player starts on an empty tile.
+		PlayerOnEmptyTile,
+
+		// A level has no buttons, so it would be won before it began.
+		NoButtons,
+
+		// A level's 'LevelInfo' doesn't match its map.
+		WrongInfo,
+
+		// A level small enough to solve has no par, so there's no way to win it.
+		// (According to the par recorded by floorfall-mapc.)
+		Unsolvable,
+
+		// A level can be won in fewer than 'LevelInfo::minimumPar' moves.
+		// (According to the par recorded by floorfall-mapc.)
+		TooEasy,
+
+		// A level's par is fewer moves than it could possibly be won in,
+		// or is odd when every win takes an even number of moves (or the other way around).
+		WrongPar,
+
+		// There's something after the last map.
+		WrongSize,
+	};
+
+	// Everything that makes up a pack.
+	struct PackContents
+	{
+		const uint8_t * data;
+		size_t size;
+
+		const LevelInfo * info;
+		size_t infoCount;
+
+		size_t thumbnailsSize;
+	};
+
+	// Returned by 'getEndBit' when the codes don't fit the map.
+	constexpr uint16_t invalidBit = 0xFFFF;
+
+	// Reads a byte of the pack.
+	// Anything past the end reads as zero, which keeps the compiler happy
+	// when a broken map runs off the end of the pack.
+	constexpr uint8_t readByte(const PackContents & pack, size_t index)
+	{
+		return (index < pack.size) ? pack.data[index] : 0;
+	}
+
+	// Reads two bytes, least significant first.
+	constexpr uint16_t readWord(const PackContents & pack, size_t index)
+	{
+		return static_cast<uint16_t>(readByte(pack, index) | (readByte(pack, index + 1) << 8));
+	}
+
+	constexpr uint16_t getLevelCount(const PackContents & pack)
+	{
+		return readWord(pack, 1);
+	}
+
+	constexpr uint16_t getLevelOffset(const PackContents & pack, uint16_t index)
+	{
+		return readWord(pack, LevelPack::headerSize + (index * LevelPack::offsetSize));
+	}
+
+	// Reads a bit of a map's tiles, as 'MapTileReader' does.
+	constexpr uint8_t readBit(const PackContents & pack, size_t map, uint16_t bit)
+	{
+		return ((readByte(pack, map + 4 + (bit / 8)) >> (7 - (bit % 8))) & 1);
+	}
+
+	constexpr uint8_t readBits(const PackContents & pack, size_t map, uint16_t bit, uint8_t count, uint8_t result = 0)
+	{
+		return (count == 0) ? result : readBits(pack, map, bit + 1, count - 1, static_cast<uint8_t>((result << 1) | readBit(pack, map, bit)));
+	}
+
+	constexpr bool isRepeat(const PackContents & pack, size_t map, uint16_t bit)
+	{
+		return (readBits(pack, map, bit, MapCode::repeatBits) == MapCode::repeat);
+	}
+
+	// The number of bits in the code that starts at 'bit'.
+	constexpr uint8_t getCodeLength(const PackContents & pack, size_t map, uint16_t bit)
+	{
+		return
+			(readBit(pack, map, bit + 0) == 0) ? MapCode::emptyTileBits :
+			(readBit(pack, map, bit + 1) == 0) ? MapCode::offButtonBits :
+			(readBit(pack, map, bit + 2) == 0) ? MapCode::solidTileBits :
+			(readBit(pack, map, bit + 3) == 0) ? (MapCode::steppedTileBits + MapCode::stepsBits) :
+			(readBit(pack, map, bit + 4) == 0) ? MapCode::onButtonBits :
+			(MapCode::repeatBits + MapCode::repeatCountBits);
+	}
+
+	// The number of tiles that the code at 'bit' stands for.
+	constexpr uint8_t getCodeTileCount(const PackContents & pack, size_t map, uint16_t bit)
+	{
+		return isRepeat(pack, map, bit) ? (readBits(pack, map, bit + MapCode::repeatBits, MapCode::repeatCountBits) + MapCode::minimumRepeat) : 1;
+	}
+
+	// The tile that the code at 'bit' stands for.
+	constexpr Tile getCodeTile(const PackContents & pack, size_t map, uint16_t bit, Tile previous)
+	{
+		return
+			(readBit(pack, map, bit + 0) == 0) ? ((readBit(pack, map, bit + 1) == 0) ? Tile::makeEmptyTile() : Tile::makeBrokenTile(1)) :
+			(readBit(pack, map, bit + 1) == 0) ? Tile::makeOffButton() :
+			(readBit(pack, map, bit + 2) == 0) ? Tile::makeSolidTile() :
+			(readBit(pack, map, bit + 3) == 0) ? Tile::makeBrokenTile(readBits(pack, map, bit + MapCode::steppedTileBits, MapCode::stepsBits)) :
+			(readBit(pack, map, bit + 4) == 0) ? Tile::makeOnButton() :
+			previous;
+	}
+
+	// The bit just after the last of 'tilesLeft' tiles,
+	// or 'invalidBit' if a repeat runs past the last of them.
+	constexpr uint16_t getEndBit(const PackContents & pack, size_t map, uint16_t bit, uint16_t tilesLeft)
+	{
+		return
+			(tilesLeft == 0) ? bit :
+			(getCodeTileCount(pack, map, bit) > tilesLeft) ? invalidBit :
+			getEndBit(pack, map, bit + getCodeLength(pack, map, bit), tilesLeft - getCodeTileCount(pack, map, bit));
+	}
+
+	// Finds the tile with the given index,
+	// which must be less than the number of tiles in the map.
+	constexpr Tile getTile(const PackContents & pack, size_t map, uint16_t bit, uint16_t index, Tile previous)
+	{
+		return (index < getCodeTileCount(pack, map, bit)) ?
+			getCodeTile(pack, map, bit, previous) :
+			getTile(pack, map, bit + getCodeLength(pack, map, bit), index - getCodeTileCount(pack, map, bit), getCodeTile(pack, map, bit, previous));
+	}
+
+	constexpr uint16_t countButtons(const PackContents & pack, size_t map, uint16_t bit, uint16_t tilesLeft, Tile previous)
+	{
+		return (tilesLeft == 0) ? 0 :
+			(((getCodeTile(pack, map, bit, previous).getType() == TileType::Button) ? getCodeTileCount(pack, map, bit) : 0) +
+			countButtons(pack, map, bit + getCodeLength(pack, map, bit), tilesLeft - getCodeTileCount(pack, map, bit), getCodeTile(pack, map, bit, previous)));
+	}
+
+	// The board's limit is checked as well as the renderer's,
+	// in case a board ever holds more steps than can be drawn.
+	constexpr bool hasTooManySteps(Tile tile, uint8_t maximumSteps)
+	{
+		return ((tile.getType() == TileType::Broken) && ((tile.getParameter() > maximumSteps) || (tile.getParameter() > Tile::maximumSteps)));
+	}
+
+	constexpr bool anyTooManySteps(const PackContents & pack, size_t map, uint16_t bit, uint16_t tilesLeft, Tile previous, uint8_t maximumSteps)
+	{
+		return (tilesLeft != 0) &&
+			(hasTooManySteps(getCodeTile(pack, map, bit, previous), maximumSteps) ||
+			anyTooManySteps(pack, map, bit + getCodeLength(pack, map, bit), tilesLeft - getCodeTileCount(pack, map, bit), getCodeTile(pack, map, bit, previous), maximumSteps));
+	}
+
+	constexpr bool isSolvableSize(const LevelInfo & info)
+	{
+		return ((info.width <= LevelInfo::maximumSolvedWidth) && (info.height <= LevelInfo::maximumSolvedHeight));
+	}
+
+	static_assert((LevelInfo::maximumSolvedWidth == BitBoard::width) && (LevelInfo::maximumSolvedHeight == BitBoard::height), "The solvers are limited to the size of a bitboard");
+
+	constexpr bool isEmptyTile(Tile tile)
+	{
+		return ((tile.getType() == TileType::Broken) && (tile.getParameter() == 0));
+	}
+
+	constexpr uint16_t getTileCount(const PackContents & pack, size_t map)
+	{
+		return (readByte(pack, map + 0) * readByte(pack, map + 1));
+	}
+
+	// The size of a map in bytes, as 'readMapSize' would find it.
+	constexpr uint16_t getMapSize(const PackContents & pack, size_t map)
+	{
+		return (4 + ((getEndBit(pack, map, 0, getTileCount(pack, map)) + 7) / 8));
+	}
+
+	constexpr bool infoMatches(const PackContents & pack, size_t map, const LevelInfo & info)
+	{
+		return
+			(info.width == readByte(pack, map + 0)) &&
+			(info.height == readByte(pack, map + 1)) &&
+			(info.buttonCount == countButtons(pack, map, 0, getTileCount(pack, map), Tile::makeEmptyTile()));
+	}
+
+	// The colour of a cell on a checkerboard, 0 or 1.
+	// Every move takes the player from one colour to the other.
+	constexpr uint8_t getColour(uint16_t x, uint16_t y)
+	{
+		return ((x + y) % 2);
+	}
+
+	constexpr uint8_t getTileColour(const PackContents & pack, size_t map, uint16_t index)
+	{
+		return getColour(index % readByte(pack, map + 0), index / readByte(pack, map + 0));
+	}
+
+	constexpr uint8_t getPlayerColour(const PackContents & pack, size_t map)
+	{
+		return getColour(readByte(pack, map + 2), readByte(pack, map + 3));
+	}
+
+	// The number of the 'count' tiles from 'index' onwards that are the given colour.
+	constexpr uint16_t countColour(const PackContents & pack, size_t map, uint16_t index, uint8_t count, uint8_t colour)
+	{
+		return (count == 0) ? 0 : (((getTileColour(pack, map, index) == colour) ? 1 : 0) + countColour(pack, map, index + 1, count - 1, colour));
+	}
+
+	constexpr bool isButton(Tile tile, bool onlyOff)
+	{
+		return ((tile.getType() == TileType::Button) && (!onlyOff || (tile.getParameter() == 0)));
+	}
+
+	// Counts the buttons (or just the off buttons) on tiles of the given colour.
+	constexpr uint16_t countButtonsOfColour(const PackContents & pack, size_t map, uint16_t bit, uint16_t index, uint16_t tilesLeft, Tile previous, uint8_t colour, bool onlyOff)
+	{
+		return (tilesLeft == 0) ? 0 :
+			((isButton(getCodeTile(pack, map, bit, previous), onlyOff) ? countColour(pack, map, index, getCodeTileCount(pack, map, bit), colour) : 0) +
+			countButtonsOfColour(pack, map, bit + getCodeLength(pack, map, bit), index + getCodeTileCount(pack, map, bit), tilesLeft - getCodeTileCount(pack, map, bit), getCodeTile(pack, map, bit, previous), colour, onlyOff));
+	}
+
+	constexpr uint16_t countButtonsOfColour(const PackContents & pack, size_t map, uint8_t colour, bool onlyOff)
+	{
+		return countButtonsOfColour(pack, map, 0, 0, getTileCount(pack, map), Tile::makeEmptyTile(), colour, onlyOff);
+	}
+
+	// The fewest moves that could win a level whose off buttons are split between
+	// the player's own colour ('same') and the other colour ('other').
+	// Moves 1, 3, 5... land on the other colour and moves 2, 4, 6... on the same colour,
+	// and each off button needs a move of its own.
+	// (This is the bound that 'BitBoard::estimateMovesLeft' gives the hint solver.)
+	constexpr uint16_t getFewestMoves(uint16_t same, uint16_t other)
+	{
+		return ((other > 0) && (((other * 2) - 1) > (same * 2))) ? ((other * 2) - 1) : (same * 2);
+	}
+
+	constexpr uint16_t getFewestMoves(const PackContents & pack, size_t map)
+	{
+		return getFewestMoves(
+			countButtonsOfColour(pack, map, getPlayerColour(pack, map), true),
+			countButtonsOfColour(pack, map, 1 - getPlayerColour(pack, map), true));
+	}
+
+	// Determines whether a level could be won in exactly 'par' moves, as far as parity goes.
+	// The last move always lands on a button, so if every button is on one colour,
+	// every win ends on that colour, which takes an even number of moves
+	// if it's the colour the player starts on and an odd number if it isn't.
+	constexpr bool hasPossibleParity(const PackContents & pack, size_t map, uint8_t par)
+	{
+		return
+			(countButtonsOfColour(pack, map, 1 - getPlayerColour(pack, map), false) == 0) ? ((par % 2) == 0) :
+			(countButtonsOfColour(pack, map, getPlayerColour(pack, map), false) == 0) ? ((par % 2) == 1) :
+			true;
+	}
+
+	constexpr bool isPossiblePar(const PackContents & pack, size_t map, const LevelInfo & info)
+	{
+		return (info.par == LevelInfo::noPar) || ((info.par >= getFewestMoves(pack, map)) && hasPossibleParity(pack, map, info.par));
+	}
+
+	// Checks a single level, which should start at 'map'.
+	constexpr Problem getLevelProblem(const PackContents & pack, uint16_t index, size_t map, uint8_t maximumWidth, uint8_t maximumHeight, uint8_t maximumSteps)
+	{
+		return
+			(getLevelOffset(pack, index) != map) ? Problem::WrongOffset :
+			((readByte(pack, map + 0) == 0) || (readByte(pack, map + 0) > maximumWidth)) ? Problem::WrongDimensions :
+			((readByte(pack, map + 1) == 0) || (readByte(pack, map + 1) > maximumHeight)) ? Problem::WrongDimensions :
+			(readByte(pack, map + 2) >= readByte(pack, map + 0)) ? Problem::PlayerOutside :
+			(readByte(pack, map + 3) >= readByte(pack, map + 1)) ? Problem::PlayerOutside :
+			(getEndBit(pack, map, 0, getTileCount(pack, map)) == invalidBit) ? Problem::WrongTiles :
+			((map + getMapSize(pack, map)) > pack.size) ? Problem::WrongTiles :
+			anyTooManySteps(pack, map, 0, getTileCount(pack, map), Tile::makeEmptyTile(), maximumSteps) ? Problem::TooManySteps :
+			isEmptyTile(getTile(pack, map, 0, (readByte(pack, map + 3) * readByte(pack, map + 0)) + readByte(pack, map + 2), Tile::makeEmptyTile())) ? Problem::PlayerOnEmptyTile :
+			(countButtons(pack, map, 0, getTileCount(pack, map), Tile::makeEmptyTile()) == 0) ? Problem::NoButtons :
+			!infoMatches(pack, map, pack.info[index]) ? Problem::WrongInfo :
+			((pack.info[index].par == LevelInfo::noPar) && isSolvableSize(pack.info[index])) ? Problem::Unsolvable :
+			(pack.info[index].par < LevelInfo::minimumPar) ? Problem::TooEasy :
+			!isPossiblePar(pack, map, pack.info[index]) ? Problem::WrongPar :
+			Problem::None;
+	}
+
+	// Checks each level from 'index' onwards, the first of which should start at 'map'.
+	constexpr Problem getLevelsProblem(const PackContents & pack, uint16_t index, size_t map, uint8_t maximumWidth, uint8_t maximumHeight, uint8_t maximumSteps)
+	{
+		return
+			(index == getLevelCount(pack)) ? ((map == pack.size) ? Problem::None : Problem::WrongSize) :
+			(getLevelProblem(pack, index, map, maximumWidth, maximumHeight, maximumSteps) != Problem::None) ? getLevelProblem(pack, index, map, maximumWidth, maximumHeight, maximumSteps) :
+			getLevelsProblem(pack, index + 1, map + getMapSize(pack, map), maximumWidth, maximumHeight, maximumSteps);
+	}
+
+	// Checks a whole pack, for a board of the given size
+	// that holds up to the given number of steps per broken tile.
+	constexpr Problem getPackProblem(const PackContents & pack, uint8_t maximumWidth, uint8_t maximumHeight, uint8_t maximumSteps)
+	{
+		return
+			(readByte(pack, 0) != LevelPack::formatVersion) ? Problem::WrongVersion :
+			(getLevelCount(pack) != pack.infoCount) ? Problem::WrongLevelCount :
+			((getLevelCount(pack) * LevelThumbnail::size) != pack.thumbnailsSize) ? Problem::WrongLevelCount :
+			getLevelsProblem(pack, 0, LevelPack::headerSize + (getLevelCount(pack) * LevelPack::offsetSize), maximumWidth, maximumHeight, maximumSteps);
+	}
+}
\ No newline at end of file
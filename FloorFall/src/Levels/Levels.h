@@ -16,55 +16,28 @@
 //  limitations under the License.
 //
 
+// For uint16_t
 #include <stdint.h>
-#include <avr/pgmspace.h>
 
-#include "Level0.h"
-#include "Level1.h"
-#include "Level2.h"
-#include "Level3.h"
-#include "Level4.h"
-#include "Level5.h"
-#include "Level6.h"
-#include "Level7.h"
-#include "Level8.h"
-#include "Level9.h"
+#include "LevelPack.h"
+#include "LevelPackChecks.h"
 
-#include "Level10.h"
-#include "Level11.h"
-// #include "Level12.h"
-// #include "Level13.h"
-// #include "Level14.h"
-// #include "Level15.h"
-// #include "Level16.h"
-// #include "Level17.h"
-// #include "Level18.h"
-// #include "Level19.h"
+// Made from the map files in 'FloorFall/Levels'.
+// Build the 'levels' target to remake it after changing them.
+#include "MainPack.h"
 
 namespace Levels
 {
-	constexpr const uint8_t * levels[] PROGMEM
-	{
-		level0,
-		level1,
-		level2,
-		level3,
-		level4,
-		level5,
-		level6,
-		level7,
-		level8,
-		level9,
+	constexpr LevelPack levels { mainPack, mainPackInfo, mainPackThumbnails };
+
+	// The same as 'levels.getLevelCount()', but usable in a constant expression.
+	constexpr uint16_t levelCount = mainPackLevelCount;
 
-		level10,
-		level11,
-		// level12,
-		// level13,
-		// level14,
-		// level15,
-		// level16,
-		// level17,
-		// level18,
-		// level19,
+	// Everything in 'levels', for 'LevelPackChecks'.
+	constexpr LevelPackChecks::PackContents levelsContents
+	{
+		mainPack, sizeof(mainPack),
+		mainPackInfo, (sizeof(mainPackInfo) / sizeof(mainPackInfo[0])),
+		sizeof(mainPackThumbnails),
 	};
 }
\ No newline at end of file
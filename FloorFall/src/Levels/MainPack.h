@@ -0,0 +1,268 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Made by floorfall-mapc, don't edit this by hand.
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+#include "LevelInfo.h"
+#include "LevelPackChecks.h"
+
+namespace Levels
+{
+	constexpr uint16_t mainPackLevelCount = 12;
+
+	constexpr uint8_t mainPack[] PROGMEM
+	{
+		// Format version
+		1,
+
+		// Level count
+		0x0C, 0x00,
+
+		// Offsets
+		0x1B, 0x00,
+		0x21, 0x00,
+		0x27, 0x00,
+		0x34, 0x00,
+		0x3F, 0x00,
+		0x4C, 0x00,
+		0x55, 0x00,
+		0x61, 0x00,
+		0x6B, 0x00,
+		0x7C, 0x00,
+		0x8A, 0x00,
+		0x91, 0x00,
+
+		// Level 0, player at 0, 0
+		// ##o#o
+		0x05, 0x01, 0x00, 0x00, 0xDA, 0xD0,
+
+		// Level 1, player at 0, 0
+		// #1o1o
+		0x05, 0x01, 0x00, 0x00, 0xCC, 0xC0,
+
+		// Level 2, player at 0, 2
+		// ..o..
+		// ..2..
+		// ####o
+		// ..2..
+		// ..o..
+		0x05, 0x05, 0x00, 0x02, 0x08, 0x03, 0x88, 0x36,
+		0xDA, 0x0E, 0x20, 0x08, 0x00,
+
+		// Level 3, player at 0, 0
+		// o1o..
+		// 1.1..
+		// o1O1o
+		// ..1.1
+		// ..o1o
+		0x05, 0x05, 0x00, 0x00, 0x98, 0x11, 0x09, 0xF3,
+		0x02, 0x21, 0x30,
+
+		// Level 4, player at 0, 2
+		// ..o..
+		// ..2..
+		// #131o
+		// ..2..
+		// ..o..
+		0x05, 0x05, 0x00, 0x02, 0x08, 0x03, 0x88, 0x33,
+		0xC6, 0xC1, 0xC4, 0x01, 0x00,
+
+		// Level 5, player at 0, 4
+		// o1o
+		// 1.1
+		// O1o
+		// 2..
+		// o..
+		0x03, 0x05, 0x00, 0x04, 0x99, 0x1F, 0x37, 0x10,
+		0x40,
+
+		// Level 6, player at 0, 4
+		// o.o
+		// 2.2
+		// o2o
+		// 2.2
+		// o.o
+		0x03, 0x05, 0x00, 0x04, 0x8B, 0x88, 0xE2, 0xB8,
+		0xAE, 0x23, 0x8A, 0x20,
+
+		// Level 7, player at 0, 4
+		// o1o
+		// 1.1
+		// O1O
+		// 2.2
+		// o.o
+		0x03, 0x05, 0x00, 0x04, 0x99, 0x1F, 0x3E, 0xE2,
+		0x38, 0xA2,
+
+		// Level 8, player at 0, 0
+		// o1o....
+		// 1.1....
+		// o1O1o..
+		// ..1.1..
+		// ..o1O1o
+		// ....1.1
+		// ....o1o
+		0x07, 0x07, 0x00, 0x00, 0x98, 0x01, 0x10, 0x09,
+		0xF3, 0x00, 0x22, 0x01, 0x3E, 0x60, 0x04, 0x40,
+		0x26,
+
+		// Level 9, player at 0, 0
+		// o11111o
+		// 1o111o1
+		// 11o1111
+		// 1111111
+		// 1111o11
+		// 1o111o1
+		// o11111o
+		0x07, 0x07, 0x00, 0x00, 0x95, 0x59, 0x95, 0x95,
+		0x9F, 0xE4, 0xAC, 0xAC, 0xCA, 0xAC,
+
+		// Level 10, player at 0, 0
+		// ooooo
+		// ooooo
+		// ooooo
+		// ooooo
+		// ooooo
+		0x05, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0x50,
+
+		// Level 11, player at 0, 0
+		// o1o1o
+		// 11111
+		// o1o1o
+		// 11111
+		// o1o1o
+		0x05, 0x05, 0x00, 0x00, 0x99, 0x95, 0x59, 0x99,
+		0x55, 0x99, 0x80,
+	};
+
+	constexpr LevelInfo mainPackInfo[] PROGMEM
+	{
+		// Width, height, buttons, broken tiles, par
+		{ 5, 1, 2, 0, 4 },
+		{ 5, 1, 2, 2, 4 },
+		{ 5, 5, 3, 2, 12 },
+		{ 5, 5, 7, 8, 16 },
+		{ 5, 5, 3, 5, 12 },
+		{ 3, 5, 5, 5, 12 },
+		{ 3, 5, 6, 5, 20 },
+		{ 3, 5, 6, 6, 16 },
+		{ 7, 7, 10, 12, 24 },
+		{ 7, 7, 10, 39, 28 },
+		{ 5, 5, 25, 0, 27 },
+		{ 5, 5, 9, 16, 18 },
+	};
+
+	constexpr uint8_t mainPackThumbnails[] PROGMEM
+	{
+		// Level 0
+		0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x03, 0x03,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 1
+		0x03, 0x03, 0x01, 0x02, 0x01, 0x00, 0x01, 0x02,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 2
+		0x30, 0x30, 0x30, 0x30, 0x75, 0xB8, 0x30, 0x30,
+		0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 3
+		0x15, 0x08, 0x11, 0x22, 0x75, 0x98, 0x10, 0x20,
+		0x50, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 4
+		0x30, 0x30, 0x10, 0x20, 0x55, 0xA8, 0x10, 0x20,
+		0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 5
+		0x75, 0x98, 0x11, 0x22, 0x15, 0x08, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 6
+		0x55, 0x88, 0x10, 0x20, 0x55, 0x88, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 7
+		0x75, 0x98, 0x11, 0x22, 0x75, 0x98, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 8
+		0x15, 0x08, 0x11, 0x22, 0x75, 0x98, 0x10, 0x20,
+		0x50, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02,
+		0x17, 0x09, 0x11, 0x22, 0x15, 0x08, 0x00, 0x00,
+
+		// Level 9
+		0x55, 0xA8, 0x55, 0xA2, 0x55, 0x8A, 0x55, 0xAA,
+		0x55, 0xAA, 0x55, 0xA2, 0x55, 0xA8, 0x00, 0x00,
+		0x15, 0x0A, 0x15, 0x22, 0x15, 0x2A, 0x15, 0x2A,
+		0x15, 0x28, 0x15, 0x22, 0x15, 0x0A, 0x00, 0x00,
+
+		// Level 10
+		0x55, 0x00, 0x55, 0x00, 0x55, 0x00, 0x55, 0x00,
+		0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		// Level 11
+		0x55, 0x88, 0x55, 0xAA, 0x55, 0x88, 0x55, 0xAA,
+		0x55, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x02,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	};
+
+	// Checks each level on its own, so that a broken level is named by the error.
+	// 'Checker::getLevelProblem(index, offset)' should check the level
+	// that starts at 'offset' against the board it'll be loaded onto.
+	template<typename Checker>
+	constexpr bool checkMainPackLevels()
+	{
+		static_assert(Checker::getLevelProblem(0, 0x001B) == LevelPackChecks::Problem::None, "Level 0 (Level0.txt) is broken");
+		static_assert(Checker::getLevelProblem(1, 0x0021) == LevelPackChecks::Problem::None, "Level 1 (Level1.txt) is broken");
+		static_assert(Checker::getLevelProblem(2, 0x0027) == LevelPackChecks::Problem::None, "Level 2 (Level2.txt) is broken");
+		static_assert(Checker::getLevelProblem(3, 0x0034) == LevelPackChecks::Problem::None, "Level 3 (Level3.txt) is broken");
+		static_assert(Checker::getLevelProblem(4, 0x003F) == LevelPackChecks::Problem::None, "Level 4 (Level4.txt) is broken");
+		static_assert(Checker::getLevelProblem(5, 0x004C) == LevelPackChecks::Problem::None, "Level 5 (Level5.txt) is broken");
+		static_assert(Checker::getLevelProblem(6, 0x0055) == LevelPackChecks::Problem::None, "Level 6 (Level6.txt) is broken");
+		static_assert(Checker::getLevelProblem(7, 0x0061) == LevelPackChecks::Problem::None, "Level 7 (Level7.txt) is broken");
+		static_assert(Checker::getLevelProblem(8, 0x006B) == LevelPackChecks::Problem::None, "Level 8 (Level8.txt) is broken");
+		static_assert(Checker::getLevelProblem(9, 0x007C) == LevelPackChecks::Problem::None, "Level 9 (Level9.txt) is broken");
+		static_assert(Checker::getLevelProblem(10, 0x008A) == LevelPackChecks::Problem::None, "Level 10 (Level10.txt) is broken");
+		static_assert(Checker::getLevelProblem(11, 0x0091) == LevelPackChecks::Problem::None, "Level 11 (Level11.txt) is broken");
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,463 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t, uint64_t
+#include <stdint.h>
+
+// For size_t
+#include <stddef.h>
+
+#include "Tile.h"
+#include "TileType.h"
+
+// An alternative to 'Grid<Tile, 8, 8>' that stores the board
+// as a handful of 64-bit planes with one bit per cell,
+// where bit ((y * 8) + x) of a plane represents the cell at (x, y).
+//
+// Broken tiles don't get a plane of their own.
+// Any cell that is neither solid nor a button is broken,
+// which means a zeroed board is entirely broken/empty tiles,
+// just like a zero-initialised 'Grid<Tile, 8, 8>'.
+//
+// The number of steps left on each broken tile is 'bit-sliced',
+// i.e. step plane 'n' holds bit 'n' of every cell's counter,
+// so every counter on the board can be decremented at once.
+class BitBoard
+{
+public:
+	// Declare names that follow the C++ standard library conventions.
+	using size_type = size_t;
+
+	// The type used for a single plane.
+	using plane_type = uint64_t;
+
+public:
+	static constexpr size_type width = 8;
+	static constexpr size_type height = 8;
+	static constexpr size_type cellCount = (width * height);
+
+	// Enough planes to hold any parameter that a 'Tile' can hold.
+	static constexpr uint8_t stepPlaneCount = 4;
+
+	// The most steps a broken tile can have.
+	// (Any more are stored as this many.)
+	static constexpr uint8_t maximumSteps = Tile::maximumSteps;
+
+	static_assert(maximumSteps < (1 << stepPlaneCount), "The step planes can't count up to maximumSteps");
+
+	// 'getSteppableMask' depends on this.
+	static_assert(stepPlaneCount == 4, "getSteppableMask must be updated to match stepPlaneCount");
+
+private:
+	// Cells containing a solid tile.
+	plane_type solidMask {};
+
+	// Cells containing a button, regardless of whether it's on or off.
+	plane_type buttonMask {};
+
+	// Cells containing a button that is on.
+	// (Always a subset of 'buttonMask'.)
+	plane_type buttonOnMask {};
+
+	// The bit-sliced step counters of the broken tiles.
+	// (Only ever set for cells that are broken.)
+	plane_type stepPlanes[stepPlaneCount] {};
+
+public:
+	constexpr size_type getWidth() const
+	{
+		return width;
+	}
+
+	constexpr size_type getHeight() const
+	{
+		return height;
+	}
+
+	constexpr size_type getCellCount() const
+	{
+		return cellCount;
+	}
+
+	constexpr size_type getLeftEdge() const
+	{
+		return 0;
+	}
+
+	constexpr size_type getTopEdge() const
+	{
+		return 0;
+	}
+
+	constexpr size_type getRightEdge() const
+	{
+		return (this->getWidth() - 1);
+	}
+
+	constexpr size_type getBottomEdge() const
+	{
+		return (this->getHeight() - 1);
+	}
+
+	// Returns the index of the bit representing the cell at (x, y).
+	static constexpr uint8_t getIndex(size_type x, size_type y)
+	{
+		return static_cast<uint8_t>((y * width) + x);
+	}
+
+	// Returns a plane with only the cell at (x, y) set.
+	static constexpr plane_type getMask(size_type x, size_type y)
+	{
+		return (static_cast<plane_type>(1) << getIndex(x, y));
+	}
+
+	constexpr plane_type getSolidMask() const
+	{
+		return this->solidMask;
+	}
+
+	constexpr plane_type getButtonMask() const
+	{
+		return this->buttonMask;
+	}
+
+	constexpr plane_type getButtonOnMask() const
+	{
+		return this->buttonOnMask;
+	}
+
+	constexpr plane_type getStepPlane(uint8_t index) const
+	{
+		return this->stepPlanes[index];
+	}
+
+	// Returns the cells containing broken tiles.
+	constexpr plane_type getBrokenMask() const
+	{
+		return ~(this->solidMask | this->buttonMask);
+	}
+
+	// Returns the broken tiles that can still be stepped on.
+	// (Written out longhand because C++11 constexpr functions can't loop.)
+	constexpr plane_type getSteppableMask() const
+	{
+		return (this->stepPlanes[0] | this->stepPlanes[1] | this->stepPlanes[2] | this->stepPlanes[3]);
+	}
+
+	// Returns the broken tiles that have no steps left.
+	constexpr plane_type getFallenMask() const
+	{
+		return (this->getBrokenMask() & ~this->getSteppableMask());
+	}
+
+	// Returns the tile at (x, y).
+	// Unlike 'Grid', this has to return by value
+	// because there's no tile object to refer to.
+	Tile getCell(size_type x, size_type y) const
+	{
+		const auto mask = getMask(x, y);
+
+		if((this->solidMask & mask) != 0)
+			return Tile::makeSolidTile();
+
+		if((this->buttonMask & mask) != 0)
+			return ((this->buttonOnMask & mask) != 0) ? Tile::makeOnButton() : Tile::makeOffButton();
+
+		// Gather the step counter from the step planes.
+		uint8_t steps = 0;
+
+		for(uint8_t index = 0; index < stepPlaneCount; ++index)
+			if((this->stepPlanes[index] & mask) != 0)
+				steps |= (1 << index);
+
+		return Tile::makeBrokenTile(steps);
+	}
+
+	// Replaces the tile at (x, y).
+	void setCell(size_type x, size_type y, Tile tile)
+	{
+		const auto mask = getMask(x, y);
+
+		// Clear the cell from every plane.
+		this->solidMask &= ~mask;
+		this->buttonMask &= ~mask;
+		this->buttonOnMask &= ~mask;
+
+		for(uint8_t index = 0; index < stepPlaneCount; ++index)
+			this->stepPlanes[index] &= ~mask;
+
+		const auto parameter = tile.getParameter();
+
+		switch(tile.getType())
+		{
+			case TileType::Solid:
+				this->solidMask |= mask;
+				break;
+
+			case TileType::Button:
+				this->buttonMask |= mask;
+
+				if(parameter != 0)
+					this->buttonOnMask |= mask;
+				break;
+
+			case TileType::Broken:
+			{
+				const uint8_t steps = (parameter < maximumSteps) ? parameter : maximumSteps;
+
+				// Scatter the step counter across the step planes.
+				for(uint8_t index = 0; index < stepPlaneCount; ++index)
+					if((steps & (1 << index)) != 0)
+						this->stepPlanes[index] |= mask;
+				break;
+			}
+		}
+	}
+
+	// Empties the board.
+	void clear()
+	{
+		*this = BitBoard();
+	}
+
+	// Handles stepping onto the cell at (x, y).
+	// Returns false if the tile was fully broken
+	// (i.e. the player fell), otherwise true.
+	bool stepOn(size_type x, size_type y)
+	{
+		const auto mask = getMask(x, y);
+
+		// Toggle the button, if there is one.
+		this->buttonOnMask ^= (mask & this->buttonMask);
+
+		// Check that there was something to stand on.
+		return ((mask & this->getFallenMask()) == 0);
+	}
+
+	// Handles stepping off of the cell at (x, y).
+	// Returns true if a step was taken off of a broken tile.
+	bool stepOff(size_type x, size_type y)
+	{
+		return (this->decrementSteps(getMask(x, y)) != 0);
+	}
+
+	// Moves from one cell to another,
+	// stepping off of the first and onto the second.
+	// Returns false if the player fell.
+	bool move(size_type fromX, size_type fromY, size_type toX, size_type toY)
+	{
+		this->stepOff(fromX, fromY);
+		return this->stepOn(toX, toY);
+	}
+
+	// Takes one step off of every broken tile in 'mask'
+	// that still has steps left.
+	// Returns the cells that were actually decremented.
+	plane_type decrementSteps(plane_type mask)
+	{
+		// Only broken tiles with steps left can be decremented.
+		mask &= this->getSteppableMask();
+
+		// Subtract one from every selected counter at once,
+		// rippling the borrow up through the planes.
+		plane_type borrow = mask;
+
+		for(uint8_t index = 0; index < stepPlaneCount; ++index)
+		{
+			const auto plane = this->stepPlanes[index];
+			this->stepPlanes[index] = (plane ^ borrow);
+			borrow &= ~plane;
+		}
+
+		return mask;
+	}
+
+	// Puts one step back onto every broken tile in 'mask'.
+	// This undoes 'decrementSteps' when given the mask that it returned.
+	void incrementSteps(plane_type mask)
+	{
+		// Add one to every selected counter at once,
+		// rippling the carry up through the planes.
+		plane_type carry = mask;
+
+		for(uint8_t index = 0; index < stepPlaneCount; ++index)
+		{
+			const auto plane = this->stepPlanes[index];
+			this->stepPlanes[index] = (plane ^ carry);
+			carry &= plane;
+		}
+	}
+
+	// Returns the buttons that are off.
+	constexpr plane_type getButtonOffMask() const
+	{
+		return (this->buttonMask & ~this->buttonOnMask);
+	}
+
+	// Shifts every cell of a plane one column to the left.
+	// Cells shifted off of the board are lost rather than wrapping around.
+	static constexpr plane_type shiftLeft(plane_type plane)
+	{
+		return ((plane >> 1) & 0x7F7F7F7F7F7F7F7F);
+	}
+
+	// Shifts every cell of a plane one column to the right.
+	static constexpr plane_type shiftRight(plane_type plane)
+	{
+		return ((plane << 1) & 0xFEFEFEFEFEFEFEFE);
+	}
+
+	// Shifts every cell of a plane one row up.
+	static constexpr plane_type shiftUp(plane_type plane)
+	{
+		return (plane >> width);
+	}
+
+	// Shifts every cell of a plane one row down.
+	static constexpr plane_type shiftDown(plane_type plane)
+	{
+		return (plane << width);
+	}
+
+	// Returns every cell that could be walked to from (x, y)
+	// without stepping onto a fully broken tile.
+	// This is an over-estimate, since tiles that would break
+	// along the way are still treated as walkable,
+	// which makes it safe for ruling out positions that can't be won.
+	plane_type getReachableMask(size_type x, size_type y) const
+	{
+		const auto walkable = ~this->getFallenMask();
+
+		plane_type reached = getMask(x, y);
+
+		// Flood outwards one cell at a time until nothing changes.
+		for(;;)
+		{
+			const auto neighbours = (shiftLeft(reached) | shiftRight(reached) | shiftUp(reached) | shiftDown(reached));
+			const auto next = (reached | (neighbours & walkable));
+
+			if(next == reached)
+				return reached;
+
+			reached = next;
+		}
+	}
+
+	// Returns the number of cells set in a plane.
+	static uint8_t countCells(plane_type plane)
+	{
+		return static_cast<uint8_t>(__builtin_popcountll(plane));
+	}
+
+	// Returns a lower bound on the number of moves needed
+	// to turn all the buttons on, with the player standing at (x, y).
+	//
+	// Each move steps onto exactly one tile, so each off button needs at least one move.
+	// Better still, if the board is coloured like a chessboard, each move
+	// steps onto the opposite colour to the last one, so moves onto each colour
+	// take turns, starting with the colour the player isn't standing on.
+	uint8_t estimateMovesLeft(size_type x, size_type y) const
+	{
+		// The cells where (x + y) is odd.
+		constexpr plane_type oddCells = 0xAA55AA55AA55AA55;
+
+		const auto offButtons = this->getButtonOffMask();
+
+		const auto playerMask = getMask(x, y);
+		const auto sameCells = (((playerMask & oddCells) != 0) ? oddCells : ~oddCells);
+
+		// Off buttons on the player's own colour need an even-numbered move,
+		// and off buttons on the other colour need an odd-numbered move.
+		const uint8_t same = countCells(offButtons & sameCells);
+		const uint8_t other = countCells(offButtons & ~sameCells);
+
+		// Moves 1, 3, 5... land on the other colour,
+		// moves 2, 4, 6... land on the same colour.
+		const uint8_t forOther = (other > 0) ? ((other * 2) - 1) : 0;
+		const uint8_t forSame = (same * 2);
+
+		return (forOther > forSame) ? forOther : forSame;
+	}
+
+	// Determines whether the player, standing at (x, y),
+	// obviously has no way of turning all the buttons on.
+	// Every test here is an over-estimate of what is possible,
+	// so a position that could be won is never reported as hopeless,
+	// but not every hopeless position is caught.
+	bool isHopeless(size_type x, size_type y) const
+	{
+		// The off buttons that still need to be stepped on.
+		const auto needy = (this->getButtonOffMask() & ~getMask(x, y));
+
+		// Every off button must still be reachable.
+		if((needy & ~this->getReachableMask(x, y)) != 0)
+			return true;
+
+		// Tiles that can still be stepped on.
+		const auto available = ~this->getFallenMask();
+
+		// Tiles that can be stepped on, off, and back on again.
+		const auto reusable = (available & (this->solidMask | this->buttonMask |
+			this->stepPlanes[1] | this->stepPlanes[2] | this->stepPlanes[3]));
+
+		// For each cell, whether the neighbour in each direction is available.
+		const auto left = shiftRight(available);
+		const auto right = shiftLeft(available);
+		const auto up = shiftDown(available);
+		const auto down = shiftUp(available);
+
+		// An off button with nothing around it can never be stepped on.
+		if((needy & ~(left | right | up | down)) != 0)
+			return true;
+
+		const auto atLeastTwo = ((left & (right | up | down)) | (right & (up | down)) | (up & down));
+
+		const auto reusableNeighbour = (shiftRight(reusable) | shiftLeft(reusable) | shiftDown(reusable) | shiftUp(reusable));
+
+		// Stepping onto a button and back off again needs either
+		// two different neighbours or one that can be used twice.
+		// Only the button that ends the level can do without,
+		// so more than one such button means there's no way to win.
+		const auto trapped = (needy & ~(atLeastTwo | reusableNeighbour));
+
+		return ((trapped & (trapped - 1)) != 0);
+	}
+
+	// Determines if all buttons are on.
+	constexpr bool areAllButtonsOn() const
+	{
+		return (this->getButtonOffMask() == 0);
+	}
+
+	bool operator ==(const BitBoard & other) const
+	{
+		for(uint8_t index = 0; index < stepPlaneCount; ++index)
+			if(this->stepPlanes[index] != other.stepPlanes[index])
+				return false;
+
+		return
+			(this->solidMask == other.solidMask) &&
+			(this->buttonMask == other.buttonMask) &&
+			(this->buttonOnMask == other.buttonOnMask);
+	}
+
+	bool operator !=(const BitBoard & other) const
+	{
+		return !(*this == other);
+	}
+};
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t
+#include <stdint.h>
+
+// The four directions the player can move in.
+// Values fit in two bits, which some things rely on.
+enum class Direction : uint8_t
+{
+	Left,
+	Right,
+	Up,
+	Down,
+};
+
+// Returns the change in X position caused by moving in a direction.
+constexpr int8_t getDeltaX(Direction direction)
+{
+	return (direction == Direction::Left) ? -1 : (direction == Direction::Right) ? 1 : 0;
+}
+
+// Returns the change in Y position caused by moving in a direction.
+constexpr int8_t getDeltaY(Direction direction)
+{
+	return (direction == Direction::Up) ? -1 : (direction == Direction::Down) ? 1 : 0;
+}
\ No newline at end of file
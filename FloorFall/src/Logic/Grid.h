@@ -86,6 +86,13 @@ public:
 		return this->cells[y][x];
 	}
 
+	// Replaces a cell.
+	// (Mainly here so that code can treat a 'Grid' and a 'BitBoard' the same way.)
+	void setCell(size_t x, size_t y, const_reference value)
+	{
+		this->cells[y][x] = value;
+	}
+
 	constexpr size_type getLeftEdge() const
 	{
 		return 0;
@@ -0,0 +1,162 @@
+#include "HintSolver.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For micros
+#include <Arduboy2.h>
+
+void HintSolver::update()
+{
+	// Spread the search over as many calls as it takes.
+	const uint32_t startTime = micros();
+
+	for(uint8_t node = 0; (node < maxNodesPerUpdate) && (this->status == HintStatus::Searching); ++node)
+	{
+		this->step();
+
+		// Checking after each node means a call can only overrun by one node.
+		if((micros() - startTime) >= microsPerUpdate)
+			break;
+	}
+}
+
+void HintSolver::step()
+{
+	// If every direction has been tried from this node...
+	if(this->nextDirection >= directionCount)
+	{
+		// If this is the starting position, this iteration is over.
+		if(this->depth == 0)
+		{
+			this->finishIteration();
+			return;
+		}
+
+		// Backtrack and carry on with the next direction from the previous node.
+		const uint8_t direction = (this->moves[this->depth - 1] & directionMask);
+		this->undoMove();
+		this->nextDirection = (direction + 1);
+		return;
+	}
+
+	const auto direction = static_cast<Direction>(this->nextDirection);
+	++this->nextDirection;
+
+	// If the move would take the player off of the map, skip it.
+	// (This matches the edge checks in 'GameplayState::movePlayer',
+	// where the edges of the map stop the player rather than the edges of the board.)
+	const int16_t x = (this->playerX + getDeltaX(direction));
+	const int16_t y = (this->playerY + getDeltaY(direction));
+
+	if((x < 0) || (x >= static_cast<int16_t>(this->mapWidth)))
+		return;
+
+	if((y < 0) || (y >= static_cast<int16_t>(this->mapHeight)))
+		return;
+
+	// If the player fell, this move is no good.
+	if(!this->makeMove(direction))
+	{
+		this->undoMove();
+		return;
+	}
+
+	// If all the buttons are on, the search is over.
+	if(this->board.areAllButtonsOn())
+	{
+		this->status = HintStatus::Found;
+		return;
+	}
+
+	// If there's obviously no way to win from here, don't go any deeper.
+	if(this->board.isHopeless(this->playerX, this->playerY))
+	{
+		this->undoMove();
+		return;
+	}
+
+	// If this can't lead to a win within the limit, don't go any deeper.
+	const uint8_t bound = (this->depth + this->board.estimateMovesLeft(this->playerX, this->playerY));
+
+	if(bound > this->limit)
+	{
+		if(bound < this->nextLimit)
+			this->nextLimit = bound;
+
+		this->undoMove();
+		return;
+	}
+
+	// Otherwise, search onwards from the new position.
+	this->nextDirection = 0;
+}
+
+bool HintSolver::makeMove(Direction direction)
+{
+	// Step off the old tile, remembering whether it lost a step.
+	const bool steppedOff = this->board.stepOff(this->playerX, this->playerY);
+
+	this->moves[this->depth] = (static_cast<uint8_t>(direction) | (steppedOff ? steppedOffFlag : 0));
+	++this->depth;
+
+	this->playerX += getDeltaX(direction);
+	this->playerY += getDeltaY(direction);
+
+	// Step onto the new tile.
+	return this->board.stepOn(this->playerX, this->playerY);
+}
+
+void HintSolver::undoMove()
+{
+	--this->depth;
+
+	const uint8_t move = this->moves[this->depth];
+	const auto direction = static_cast<Direction>(move & directionMask);
+
+	// Stepping onto a tile only ever toggles a button,
+	// and toggling a button a second time puts it back.
+	this->board.stepOn(this->playerX, this->playerY);
+
+	this->playerX -= getDeltaX(direction);
+	this->playerY -= getDeltaY(direction);
+
+	// Put back the step taken off of the old tile.
+	if((move & steppedOffFlag) != 0)
+		this->board.incrementSteps(BitBoard::getMask(this->playerX, this->playerY));
+}
+
+void HintSolver::finishIteration()
+{
+	// If nothing was cut short, every sequence of moves has been tried.
+	if(this->nextLimit == noLimit)
+	{
+		this->status = HintStatus::Lost;
+		return;
+	}
+
+	// If the limit can't be raised far enough, give up.
+	if(this->nextLimit > maxDepth)
+	{
+		this->status = HintStatus::GaveUp;
+		return;
+	}
+
+	// Try again, allowing more moves.
+	this->limit = this->nextLimit;
+	this->nextLimit = noLimit;
+	this->nextDirection = 0;
+}
\ No newline at end of file
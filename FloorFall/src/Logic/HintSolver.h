@@ -0,0 +1,189 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t
+#include <stdint.h>
+
+#include "BitBoard.h"
+#include "Direction.h"
+
+enum class HintStatus : uint8_t
+{
+	// Not doing anything.
+	Idle,
+
+	// Still looking for a solution.
+	Searching,
+
+	// A solution was found, 'getHint' says which way to go.
+	Found,
+
+	// There is no way to win from this position.
+	Lost,
+
+	// No solution exists within 'HintSolver::maxDepth' moves,
+	// or the map is too big for the hint solver's bitboard.
+	GaveUp,
+};
+
+// Searches for a way to win from a given position,
+// a few nodes at a time so that it can be spread over many frames.
+//
+// The search is an iterative-deepening depth-first search.
+// Rather than keeping a copy of the board for each move,
+// it works on a single copy of the board and keeps a stack of
+// the moves made (one byte each), undoing them as it backtracks.
+//
+// Each iteration only looks at move sequences that could win within 'limit' moves,
+// using 'BitBoard::estimateMovesLeft' as a lower bound on the moves left.
+// The next iteration's limit is the lowest bound that was exceeded.
+// If an iteration finishes without having to cut anything short,
+// every possible sequence of moves has been tried and the position is lost.
+class HintSolver
+{
+public:
+	// The longest solution that will be looked for.
+	// This is also the size of the move stack in bytes.
+	static constexpr uint8_t maxDepth = 48;
+
+	// How long each call to 'update' may search for, in microseconds.
+	// A node's cost depends on the board and on how deep the search is,
+	// so rather than visiting a fixed number of nodes,
+	// 'update' keeps visiting them until this much time has passed.
+	// That's a quarter of a 16.6ms frame, leaving the rest for everything else.
+	// (The profiler charges the search to 'ProfileSection::HintSearch',
+	// so the tour's hint shows whether that holds.)
+	static constexpr uint16_t microsPerUpdate = 4000;
+
+	// The most nodes a call to 'update' may visit, however quickly it visits them.
+	// On an ATmega32U4 the time runs out long before this does,
+	// but on a fast host this keeps the number of frames a search takes predictable.
+	static constexpr uint8_t maxNodesPerUpdate = 255;
+
+private:
+	// Layout of a move stack entry.
+	static constexpr uint8_t directionMask = 0x03;
+	static constexpr uint8_t steppedOffFlag = 0x04;
+
+	// The value of 'nextDirection' when every direction has been tried.
+	static constexpr uint8_t directionCount = 4;
+
+	// The value of 'nextLimit' when nothing has been cut short.
+	static constexpr uint8_t noLimit = 0xFF;
+
+private:
+	// The board being searched, the size of the map on it,
+	// and the player's position on it.
+	BitBoard board {};
+	uint8_t mapWidth { 0 };
+	uint8_t mapHeight { 0 };
+	uint8_t playerX { 0 };
+	uint8_t playerY { 0 };
+
+	// The moves leading to the current node.
+	uint8_t moves[maxDepth] {};
+	uint8_t depth { 0 };
+
+	// The current iteration's bound on the length of a solution.
+	uint8_t limit { 0 };
+
+	// The next direction to try from the current node.
+	uint8_t nextDirection { 0 };
+
+	// The lowest bound that would have let the current iteration
+	// go further than it did, or 'noLimit' if nothing was cut short.
+	uint8_t nextLimit { noLimit };
+
+	HintStatus status { HintStatus::Idle };
+
+public:
+	// Starts searching from the given position,
+	// on a map of the given size in the top left of the board.
+	// 'Board' can be a 'Grid' of 'Tile's, a 'PackedGrid' or a 'BitBoard'.
+	template<typename Board>
+	void start(const Board & source, uint8_t mapWidth, uint8_t mapHeight, uint8_t playerX, uint8_t playerY);
+
+	// Stops searching and forgets any hint.
+	void cancel()
+	{
+		this->status = HintStatus::Idle;
+	}
+
+	// Continues searching for up to 'microsPerUpdate' microseconds,
+	// if a search is in progress.
+	void update();
+
+	HintStatus getStatus() const
+	{
+		return this->status;
+	}
+
+	// Returns the first move of the solution.
+	// Only meaningful when the status is 'HintStatus::Found'.
+	Direction getHint() const
+	{
+		return static_cast<Direction>(this->moves[0] & directionMask);
+	}
+
+private:
+	// Visits one node.
+	void step();
+
+	// Moves the player, pushing the move onto the stack.
+	// Returns false if the player fell.
+	bool makeMove(Direction direction);
+
+	// Pops the last move from the stack and undoes it.
+	void undoMove();
+
+	// Starts the next iteration, or finishes the search.
+	void finishIteration();
+};
+
+template<typename Board>
+void HintSolver::start(const Board & source, uint8_t mapWidth, uint8_t mapHeight, uint8_t playerX, uint8_t playerY)
+{
+	// A map that doesn't fit on a bitboard can't be searched.
+	if((mapWidth > this->board.getWidth()) || (mapHeight > this->board.getHeight()))
+	{
+		this->status = HintStatus::GaveUp;
+		return;
+	}
+
+	// Take a copy of the board.
+	for(uint8_t y = 0; y < this->board.getHeight(); ++y)
+		for(uint8_t x = 0; x < this->board.getWidth(); ++x)
+			this->board.setCell(x, y, source.getCell(x, y));
+
+	this->mapWidth = mapWidth;
+	this->mapHeight = mapHeight;
+
+	this->playerX = playerX;
+	this->playerY = playerY;
+
+	this->depth = 0;
+	this->nextDirection = 0;
+	this->nextLimit = noLimit;
+
+	// There's no point looking for anything shorter than
+	// the fewest moves that could possibly win.
+	this->limit = this->board.estimateMovesLeft(playerX, playerY);
+
+	// If every button is already on, there's nothing to hint at.
+	this->status = this->board.areAllButtonsOn() ? HintStatus::Idle : HintStatus::Searching;
+}
\ No newline at end of file
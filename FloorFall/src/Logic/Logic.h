@@ -16,4 +16,10 @@
 
 #include "TileType.h"
 #include "Tile.h"
-#include "Grid.h"
\ No newline at end of file
+#include "Grid.h"
+#include "PackedGrid.h"
+#include "BitBoard.h"
+#include "MapLoading.h"
+#include "Direction.h"
+#include "MoveHistory.h"
+#include "Replay.h"
\ No newline at end of file
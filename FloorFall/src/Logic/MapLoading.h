@@ -16,38 +16,228 @@
 //  limitations under the License.
 //
 
+// For uint8_t
 #include <stdint.h>
+
+// For size_t
 #include <stddef.h>
 
+// For pgm_read_byte
 #include <avr/pgmspace.h>
 
 #include "Tile.h"
 
-constexpr uint8_t boardWidth = 8;
-constexpr uint8_t boardHeight = 8;
+// Maps are stored in progmem in the following format:
+// - Width, Height
+// - Player X, Player Y
+// - The tiles, row by row, as a stream of codes.
+//
+// The codes are packed into bytes most significant bit first,
+// one straight after another, with no padding between rows.
+// (Only the last byte may end with some unused zero bits.)
+//
+// The shortest codes go to the most common tiles:
+//   00            An empty tile
+//   01            A broken tile with one step left
+//   10            An off button
+//   110           A solid tile
+//   1110 SSSS     A broken tile with 'SSSS' steps left (at most 'Tile::maximumSteps')
+//   11110         An on button
+//   11111 NNNN    'NNNN' + 2 more of the previous tile
+//
+// For the levels this was written for,
+// that's a little under half the size of storing two tiles per byte.
+namespace MapCode
+{
+	constexpr uint8_t emptyTile = 0x0;
+	constexpr uint8_t emptyTileBits = 2;
+
+	constexpr uint8_t brokenTile = 0x1;
+	constexpr uint8_t brokenTileBits = 2;
+
+	constexpr uint8_t offButton = 0x2;
+	constexpr uint8_t offButtonBits = 2;
+
+	constexpr uint8_t solidTile = 0x6;
+	constexpr uint8_t solidTileBits = 3;
+
+	constexpr uint8_t steppedTile = 0xE;
+	constexpr uint8_t steppedTileBits = 4;
+	constexpr uint8_t stepsBits = 4;
+
+	constexpr uint8_t onButton = 0x1E;
+	constexpr uint8_t onButtonBits = 5;
+
+	constexpr uint8_t repeat = 0x1F;
+	constexpr uint8_t repeatBits = 5;
+	constexpr uint8_t repeatCountBits = 4;
+
+	// The shortest run that a repeat code describes.
+	constexpr uint8_t minimumRepeat = 2;
+	constexpr uint8_t maximumRepeat = (minimumRepeat + ((1 << repeatCountBits) - 1));
+}
+
+// Reads the width of a map.
+inline uint8_t readMapWidth(const uint8_t * map)
+{
+	return pgm_read_byte(&map[0]);
+}
+
+// Reads the height of a map.
+inline uint8_t readMapHeight(const uint8_t * map)
+{
+	return pgm_read_byte(&map[1]);
+}
 
-constexpr size_t mapSize = ((boardWidth * boardHeight) / (8 / 4));
+// Reads the player's starting X position.
+inline uint8_t readMapPlayerX(const uint8_t * map)
+{
+	return pgm_read_byte(&map[2]);
+}
 
-inline void loadMap(Tile (& board)[boardHeight][boardWidth], const uint8_t (& map)[mapSize])
+// Reads the player's starting Y position.
+inline uint8_t readMapPlayerY(const uint8_t * map)
 {
-	for(uint8_t y = 0; y < boardHeight; ++y)
+	return pgm_read_byte(&map[3]);
+}
+
+// Reads a map's tiles one at a time, straight out of progmem.
+class MapTileReader
+{
+private:
+	// The next byte to be loaded.
+	const uint8_t * data;
+
+	// The bits of the current byte that haven't been read yet,
+	// shifted up to the most significant end.
+	uint8_t bits { 0 };
+	uint8_t bitsLeft { 0 };
+
+	// The last tile read, and how many more copies of it are due.
+	Tile tile { Tile::makeEmptyTile() };
+	uint8_t repeatsLeft { 0 };
+
+public:
+	explicit MapTileReader(const uint8_t * map) :
+		data { &map[4] }
 	{
-		const size_t rowOffset = (y * boardWidth);
+	}
 
-		for(uint8_t x = 0; x < boardWidth; x += 2)
+	// Reads the next tile.
+	Tile readTile()
+	{
+		if(this->repeatsLeft > 0)
 		{
-			const size_t index = (rowOffset + (x / 2));
-			const uint8_t mapByte = pgm_read_byte(&map[index]);
+			--this->repeatsLeft;
+			return this->tile;
+		}
 
-			const TileType type0 = static_cast<TileType>((mapByte >> 0) & 0x03);
-			const uint8_t parameter0 = ((mapByte >> 2) & 0x03);
+		// Read bits until they form a whole code.
+		// (The prefixes are '0', '10', '110', '1110' and '1111'.)
+		if(this->readBit() == 0)
+			this->tile = (this->readBit() == 0) ? Tile::makeEmptyTile() : Tile::makeBrokenTile(1);
+		else if(this->readBit() == 0)
+			this->tile = Tile::makeOffButton();
+		else if(this->readBit() == 0)
+			this->tile = Tile::makeSolidTile();
+		else if(this->readBit() == 0)
+			this->tile = Tile::makeBrokenTile(this->readBits(MapCode::stepsBits));
+		else if(this->readBit() == 0)
+			this->tile = Tile::makeOnButton();
+		else
+			// The repeat code itself stands for the first of the copies.
+			this->repeatsLeft = (this->readBits(MapCode::repeatCountBits) + (MapCode::minimumRepeat - 1));
 
-			board[y][x + 0] = Tile(type0, parameter0);
+		return this->tile;
+	}
 
-			const TileType type1 = static_cast<TileType>((mapByte >> 4) & 0x03);
-			const uint8_t parameter1 = ((mapByte >> 6) & 0x03);
+	// The first byte after the last code read.
+	// Once every tile has been read, this is the end of the map.
+	const uint8_t * getEnd() const
+	{
+		return this->data;
+	}
 
-			board[y][x + 1] = Tile(type1, parameter1);
+private:
+	uint8_t readBit()
+	{
+		if(this->bitsLeft == 0)
+		{
+			this->bits = pgm_read_byte(this->data);
+			++this->data;
+			this->bitsLeft = 8;
 		}
+
+		const uint8_t bit = (this->bits >> 7);
+
+		this->bits <<= 1;
+		--this->bitsLeft;
+
+		return bit;
+	}
+
+	uint8_t readBits(uint8_t count)
+	{
+		uint8_t result = 0;
+
+		for(uint8_t index = 0; index < count; ++index)
+			result = static_cast<uint8_t>((result << 1) | this->readBit());
+
+		return result;
 	}
+};
+
+// Fills a board with the tiles of a map, in a single pass over the map.
+// Any part of the board that lies outside the map is cleared.
+// 'Board' can be anything with 'getWidth', 'getHeight' and 'setCell',
+// i.e. a 'Grid' of 'Tile's or a 'BitBoard'.
+template<typename Board>
+void loadMapTiles(Board & board, const uint8_t * map)
+{
+	// Read the map dimensions
+	const uint8_t width = readMapWidth(map);
+	const uint8_t height = readMapHeight(map);
+
+	MapTileReader reader { map };
+
+	// Prepare an empty tile to copy.
+	// (Oddly enough, this does actually save memory.)
+	constexpr auto emptyTile = Tile::makeEmptyTile();
+
+	// Loop through the board.
+	for(uint8_t y = 0; y < board.getHeight(); ++y)
+	{
+		// If the row is outside the map...
+		if(y >= height)
+		{
+			// Clear the row.
+			for(uint8_t x = 0; x < board.getWidth(); ++x)
+				board.setCell(x, y, emptyTile);
+
+			// Continue to the next row.
+			continue;
+		}
+
+		for(uint8_t x = 0; x < board.getWidth(); ++x)
+			// If the tile is inside the map, read it, otherwise clear it.
+			board.setCell(x, y, (x < width) ? reader.readTile() : emptyTile);
+
+		// Skip any part of the row that doesn't fit on the board.
+		for(uint8_t x = board.getWidth(); x < width; ++x)
+			reader.readTile();
+	}
+}
+
+// Calculates the size of a map in bytes.
+// (The map has to be decoded to find out.)
+inline size_t readMapSize(const uint8_t * map)
+{
+	const uint16_t tileCount = (readMapWidth(map) * readMapHeight(map));
+
+	MapTileReader reader { map };
+
+	for(uint16_t index = 0; index < tileCount; ++index)
+		reader.readTile();
+
+	return static_cast<size_t>(reader.getEnd() - map);
 }
\ No newline at end of file
@@ -0,0 +1,159 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t
+#include <stdint.h>
+
+#include "Direction.h"
+
+// A move, as the direction the player went in and what it changed.
+//
+// Stepping off of a tile can only ever take a step from a broken tile,
+// and stepping onto a tile can only ever toggle a button,
+// so those are all that's recorded about the tiles.
+// Recording whether they happened, rather than working it out from the tiles afterwards,
+// means a move that changed neither tile (such as stepping off of a tile with no steps left)
+// is undone exactly.
+struct Move
+{
+	Direction direction;
+
+	// Whether the tile that was left lost a step.
+	bool tookStep;
+
+	// Whether the tile that was arrived at was toggled.
+	bool toggledButton;
+};
+
+// Remembers the last 'capacity' moves for undoing them,
+// forgetting the oldest move whenever a new one won't fit.
+//
+// Each move is recorded in four bits:
+// two for the direction, and one each for the changes to the tiles at either end.
+//
+// There's no heap, so it's a fixed-size ring buffer,
+// and adding or removing a move takes the same time however full it is.
+template<uint8_t capacityValue>
+class MoveHistory
+{
+public:
+	static constexpr uint8_t capacity = capacityValue;
+
+	static_assert(capacity > 0, "A history must be able to hold at least one move");
+	static_assert((capacity % 2) == 0, "Two moves are kept in each byte, so the capacity must be even");
+	static_assert(capacity < 0xFF, "The number of moves must fit in a byte");
+
+private:
+	static constexpr uint8_t movesPerByte = 2;
+	static constexpr uint8_t bitsPerMove = 4;
+
+private:
+	static constexpr uint8_t tookStepBit = (1 << 2);
+	static constexpr uint8_t toggledButtonBit = (1 << 3);
+
+private:
+	// Each move's direction is in the low two bits,
+	// and the two bits above say what it changed.
+	uint8_t moves[capacity / movesPerByte] {};
+
+	// Where the oldest move is kept.
+	uint8_t first { 0 };
+
+	// The number of moves kept.
+	uint8_t count { 0 };
+
+public:
+	bool isEmpty() const
+	{
+		return (this->count == 0);
+	}
+
+	uint8_t getCount() const
+	{
+		return this->count;
+	}
+
+	// Forgets every move.
+	void clear()
+	{
+		this->first = 0;
+		this->count = 0;
+	}
+
+	// Records a move, forgetting the oldest move if there's no room.
+	void push(Move move)
+	{
+		if(this->count == capacity)
+		{
+			// The newest move takes the oldest move's slot.
+			this->first = nextSlot(this->first);
+			--this->count;
+		}
+
+		uint8_t value = static_cast<uint8_t>(move.direction);
+
+		if(move.tookStep)
+			value |= tookStepBit;
+
+		if(move.toggledButton)
+			value |= toggledButtonBit;
+
+		this->writeSlot(this->getSlot(this->count), value);
+
+		++this->count;
+	}
+
+	// Removes and returns the newest move.
+	// The history mustn't be empty.
+	Move pop()
+	{
+		--this->count;
+
+		const uint8_t value = this->readSlot(this->getSlot(this->count));
+
+		return Move { static_cast<Direction>(value & 0x3), ((value & tookStepBit) != 0), ((value & toggledButtonBit) != 0) };
+	}
+
+private:
+	static uint8_t nextSlot(uint8_t slot)
+	{
+		return ((slot + 1) < capacity) ? (slot + 1) : 0;
+	}
+
+	// Finds the slot of the move that's 'offset' moves newer than the oldest.
+	// (The offset is never more than the capacity, so one subtraction wraps it.)
+	uint8_t getSlot(uint8_t offset) const
+	{
+		const uint16_t slot = (this->first + offset);
+		return static_cast<uint8_t>((slot < capacity) ? slot : (slot - capacity));
+	}
+
+	uint8_t readSlot(uint8_t slot) const
+	{
+		const uint8_t shift = ((slot % movesPerByte) * bitsPerMove);
+		return ((this->moves[slot / movesPerByte] >> shift) & 0xF);
+	}
+
+	void writeSlot(uint8_t slot, uint8_t value)
+	{
+		const uint8_t shift = ((slot % movesPerByte) * bitsPerMove);
+		uint8_t & byte = this->moves[slot / movesPerByte];
+
+		byte = static_cast<uint8_t>((byte & ~(0xF << shift)) | (value << shift));
+	}
+};
\ No newline at end of file
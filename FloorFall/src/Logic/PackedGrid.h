@@ -0,0 +1,201 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For size_t
+#include <stddef.h>
+
+#include "Tile.h"
+#include "TileType.h"
+
+// An alternative to 'Grid<Tile, width, height>' that keeps two tiles in each byte,
+// which halves the RAM a board takes, at the cost of packing and unpacking
+// each tile as it's written and read.
+//
+// Each tile is squeezed into four bits:
+//   0-12   A broken tile with that many steps left
+//   13     A solid tile
+//   14     An off button
+//   15     An on button
+//
+// Zero is an empty tile, so a zeroed grid is entirely empty tiles,
+// just like a zero-initialised 'Grid<Tile, width, height>'.
+// Of each byte, the even cell is kept in the low four bits
+// and the odd cell in the high four bits.
+template<size_t widthValue, size_t heightValue>
+class PackedGrid
+{
+public:
+	// Declare names that follow the C++ standard library conventions.
+	using size_type = size_t;
+
+public:
+	static constexpr size_type width = widthValue;
+	static constexpr size_type height = heightValue;
+	static constexpr size_type cellCount = (width * height);
+
+	// The most steps a broken tile can have.
+	// (Any more are stored as this many.)
+	// The codes could count up to 12, but there are no frames to draw any more than this.
+	static constexpr uint8_t maximumSteps = Tile::maximumSteps;
+
+	static_assert(cellCount <= 0xFFFF, "Cells are indexed with uint16_t");
+
+private:
+	static constexpr uint8_t solidCode = 13;
+	static constexpr uint8_t offButtonCode = 14;
+	static constexpr uint8_t onButtonCode = 15;
+
+	static_assert(maximumSteps < solidCode, "The step counts would overlap the other codes");
+
+	static constexpr uint8_t codeMask = 0x0F;
+	static constexpr uint8_t codeBits = 4;
+
+private:
+	uint8_t cells[(cellCount + 1) / 2] {};
+
+public:
+	constexpr size_type getWidth() const
+	{
+		return width;
+	}
+
+	constexpr size_type getHeight() const
+	{
+		return height;
+	}
+
+	constexpr size_type getCellCount() const
+	{
+		return cellCount;
+	}
+
+	constexpr size_type getLeftEdge() const
+	{
+		return 0;
+	}
+
+	constexpr size_type getTopEdge() const
+	{
+		return 0;
+	}
+
+	constexpr size_type getRightEdge() const
+	{
+		return (this->getWidth() - 1);
+	}
+
+	constexpr size_type getBottomEdge() const
+	{
+		return (this->getHeight() - 1);
+	}
+
+	// Returns the tile at (x, y).
+	// Like 'BitBoard', this has to return by value
+	// because there's no tile object to refer to.
+	Tile getCell(size_type x, size_type y) const
+	{
+		const uint16_t index = getIndex(x, y);
+		const uint8_t code = ((this->cells[index / 2] >> getShift(index)) & codeMask);
+
+		return unpack(code);
+	}
+
+	// Replaces the tile at (x, y).
+	void setCell(size_type x, size_type y, Tile tile)
+	{
+		const uint16_t index = getIndex(x, y);
+		const uint8_t shift = getShift(index);
+
+		uint8_t & byte = this->cells[index / 2];
+
+		byte = static_cast<uint8_t>((byte & ~(codeMask << shift)) | (pack(tile) << shift));
+	}
+
+	// Determines whether any cell holds the given tile.
+	// This looks at the packed bytes directly, which is much quicker
+	// than unpacking every cell with 'getCell'.
+	bool contains(Tile tile) const
+	{
+		const uint8_t code = pack(tile);
+
+		for(uint16_t index = 0; index < sizeof(this->cells); ++index)
+		{
+			const uint8_t byte = this->cells[index];
+
+			if(((byte & codeMask) == code) || ((byte >> codeBits) == code))
+				return true;
+		}
+
+		return false;
+	}
+
+	// Empties the grid.
+	void clear()
+	{
+		*this = PackedGrid();
+	}
+
+private:
+	static constexpr uint16_t getIndex(size_type x, size_type y)
+	{
+		return static_cast<uint16_t>((y * width) + x);
+	}
+
+	static constexpr uint8_t getShift(uint16_t index)
+	{
+		return ((index % 2) * codeBits);
+	}
+
+	static uint8_t pack(Tile tile)
+	{
+		const uint8_t parameter = tile.getParameter();
+
+		switch(tile.getType())
+		{
+			case TileType::Solid:
+				return solidCode;
+
+			case TileType::Button:
+				return (parameter != 0) ? onButtonCode : offButtonCode;
+
+			default:
+				return (parameter < maximumSteps) ? parameter : maximumSteps;
+		}
+	}
+
+	static Tile unpack(uint8_t code)
+	{
+		switch(code)
+		{
+			case solidCode:
+				return Tile::makeSolidTile();
+
+			case offButtonCode:
+				return Tile::makeOffButton();
+
+			case onButtonCode:
+				return Tile::makeOnButton();
+
+			default:
+				return Tile::makeBrokenTile(code);
+		}
+	}
+};
\ No newline at end of file
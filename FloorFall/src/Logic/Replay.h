@@ -0,0 +1,243 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For size_t
+#include <stddef.h>
+
+#include "Direction.h"
+#include "Tile.h"
+
+#include "../Utils/Crc16.h"
+
+// Hashes the state of a map on a board and the player's position,
+// so that a replay can tell whether it's being played back
+// from the position it was recorded from.
+// Only the map is hashed, so the hash doesn't depend on the size of the board.
+// Works with any board that provides its tiles through 'getCell'.
+template<typename Board>
+uint16_t hashBoard(const Board & board, uint8_t mapWidth, uint8_t mapHeight, uint8_t playerX, uint8_t playerY)
+{
+	uint16_t hash = Utils::crc16Seed;
+
+	hash = Utils::updateCrc16(hash, playerX);
+	hash = Utils::updateCrc16(hash, playerY);
+
+	for(uint8_t y = 0; y < mapHeight; ++y)
+		for(uint8_t x = 0; x < mapWidth; ++x)
+		{
+			const Tile tile = board.getCell(x, y);
+
+			// Hash the type and the parameter rather than the tile's bits,
+			// so that the hash doesn't depend on how a tile is stored.
+			const uint8_t value = static_cast<uint8_t>((static_cast<uint8_t>(tile.getType()) << 4) | tile.getParameter());
+
+			hash = Utils::updateCrc16(hash, value);
+		}
+
+	return hash;
+}
+
+// A recording of the moves made on a level, for playing back later.
+//
+// Each move is a 'Direction', so four fit in a byte.
+// Only moves that were actually made are recorded,
+// and undoing a move removes it again,
+// so playing back the moves always ends up in the same place.
+//
+// As bytes, a replay is:
+//   The format version (1 byte)
+//   The level index (2 bytes, low byte first)
+//   The board hash (2 bytes, low byte first, see 'hashBoard')
+//   The move count (1 byte)
+//   The moves (4 per byte, the first in the highest two bits)
+class Replay
+{
+public:
+	static constexpr uint8_t formatVersion = 2;
+
+	static constexpr uint8_t headerSize = 6;
+
+	// The most moves a replay can hold.
+	static constexpr uint8_t capacity = 128;
+
+	static constexpr uint8_t movesPerByte = 4;
+	static constexpr uint8_t bitsPerMove = 2;
+
+	// The size of a full replay, in bytes.
+	static constexpr uint8_t maximumSize = (headerSize + (capacity / movesPerByte));
+
+	static_assert((capacity % movesPerByte) == 0, "The capacity must be a whole number of bytes");
+
+private:
+	uint16_t levelIndex { 0 };
+	uint16_t boardHash { 0 };
+
+	uint8_t moveCount { 0 };
+
+	// The number of moves made after the replay was full.
+	// While there are any, the replay is incomplete.
+	uint8_t droppedMoves { 0 };
+
+	uint8_t moves[capacity / movesPerByte] {};
+
+public:
+	// Forgets every move and starts recording a new level.
+	void begin(uint16_t levelIndex, uint16_t boardHash)
+	{
+		this->levelIndex = levelIndex;
+		this->boardHash = boardHash;
+		this->moveCount = 0;
+		this->droppedMoves = 0;
+	}
+
+	uint16_t getLevelIndex() const
+	{
+		return this->levelIndex;
+	}
+
+	uint16_t getBoardHash() const
+	{
+		return this->boardHash;
+	}
+
+	uint8_t getMoveCount() const
+	{
+		return this->moveCount;
+	}
+
+	// The number of moves made, including any there wasn't room for.
+	uint16_t getTotalMoveCount() const
+	{
+		return (this->moveCount + this->droppedMoves);
+	}
+
+	// Determines whether every move made is in the replay.
+	bool isComplete() const
+	{
+		return (this->droppedMoves == 0);
+	}
+
+	// Records a move.
+	// Returns false if there was no room for it,
+	// in which case the replay is incomplete until it's removed again.
+	bool record(Direction direction)
+	{
+		if((this->droppedMoves > 0) || (this->moveCount == capacity))
+		{
+			// Count it anyway, so that undoing it
+			// doesn't remove a move that was recorded.
+			if(this->droppedMoves < 0xFF)
+				++this->droppedMoves;
+
+			return false;
+		}
+
+		const uint8_t shift = getShift(this->moveCount);
+		uint8_t & byte = this->moves[this->moveCount / movesPerByte];
+
+		byte = static_cast<uint8_t>((byte & ~(0x3 << shift)) | (static_cast<uint8_t>(direction) << shift));
+
+		++this->moveCount;
+
+		return true;
+	}
+
+	// Removes the last move made, because it was undone.
+	void removeLast()
+	{
+		if(this->droppedMoves > 0)
+			--this->droppedMoves;
+		else if(this->moveCount > 0)
+			--this->moveCount;
+	}
+
+	// Returns a recorded move.
+	// The index must be less than the move count.
+	Direction getMove(uint8_t index) const
+	{
+		return static_cast<Direction>((this->moves[index / movesPerByte] >> getShift(index)) & 0x3);
+	}
+
+	// The size of the replay in bytes.
+	uint8_t getSize() const
+	{
+		return static_cast<uint8_t>(headerSize + ((this->moveCount + (movesPerByte - 1)) / movesPerByte));
+	}
+
+	// Returns a byte of the replay.
+	// The index must be less than the size.
+	uint8_t getByte(uint8_t index) const
+	{
+		switch(index)
+		{
+			case 0: return formatVersion;
+			case 1: return static_cast<uint8_t>(this->levelIndex & 0xFF);
+			case 2: return static_cast<uint8_t>(this->levelIndex >> 8);
+			case 3: return static_cast<uint8_t>(this->boardHash & 0xFF);
+			case 4: return static_cast<uint8_t>(this->boardHash >> 8);
+			case 5: return this->moveCount;
+
+			default:
+				{
+					const uint8_t moveByte = (index - headerSize);
+
+					// Unused moves in the last byte are always zero,
+					// so that the same moves always produce the same bytes.
+					const uint8_t usedMoves = (this->moveCount - (moveByte * movesPerByte));
+
+					if(usedMoves >= movesPerByte)
+						return this->moves[moveByte];
+
+					return static_cast<uint8_t>(this->moves[moveByte] & ~(0xFF >> (usedMoves * bitsPerMove)));
+				}
+		}
+	}
+
+	// Reads a replay from bytes.
+	// Returns false, leaving the replay unchanged, if they aren't a valid replay.
+	bool load(const uint8_t * bytes, size_t size)
+	{
+		if((size < headerSize) || (bytes[0] != formatVersion))
+			return false;
+
+		const uint8_t moveCount = bytes[5];
+
+		if((moveCount > capacity) || (size != static_cast<size_t>(headerSize + ((moveCount + (movesPerByte - 1)) / movesPerByte))))
+			return false;
+
+		this->levelIndex = static_cast<uint16_t>(bytes[1] | (bytes[2] << 8));
+		this->boardHash = static_cast<uint16_t>(bytes[3] | (bytes[4] << 8));
+		this->moveCount = moveCount;
+		this->droppedMoves = 0;
+
+		for(size_t index = headerSize; index < size; ++index)
+			this->moves[index - headerSize] = bytes[index];
+
+		return true;
+	}
+
+private:
+	// The first move of each byte is kept in the highest bits.
+	static constexpr uint8_t getShift(uint8_t index)
+	{
+		return static_cast<uint8_t>((movesPerByte - 1 - (index % movesPerByte)) * bitsPerMove);
+	}
+};
\ No newline at end of file
@@ -33,6 +33,11 @@ private:
 	uint8_t value = 0;
 
 public:
+	// The most steps a broken tile can have.
+	// A broken tile is drawn with one frame per number of steps,
+	// so this is one less than 'Images::brokenTileFrameCount'.
+	static constexpr uint8_t maximumSteps = 9;
+
 	constexpr Tile() = default;
 
 	explicit constexpr Tile(uint8_t value) :
@@ -124,27 +129,4 @@ private:
 	{
 		return (value & ~(parameterMask << parameterShift));
 	}
-};
-
-constexpr uint8_t toTileByte(Tile leftTile, Tile rightTile)
-{
-	return
-		(
-			((static_cast<uint8_t>(leftTile.getType()) & 0x3) << 0) |
-			((static_cast<uint8_t>(leftTile.getParameter()) & 0x3) << 2) |
-			((static_cast<uint8_t>(rightTile.getType()) & 0x3) << 4) |
-			((static_cast<uint8_t>(rightTile.getParameter()) & 0x3) << 6)
-		);
-}
-
-constexpr Tile getLeftTile(uint8_t tileByte)
-{
-	// Construct a tile from the lower nibble
-	return Tile(static_cast<TileType>((tileByte >> 0) & 0x03), ((tileByte >> 2) & 0x03));
-}
-
-constexpr Tile getRightTile(uint8_t tileByte)
-{
-	// Construct a tile from the higher nibble
-	return Tile(static_cast<TileType>((tileByte >> 4) & 0x03), ((tileByte >> 6) & 0x03));
-}
\ No newline at end of file
+};
\ No newline at end of file
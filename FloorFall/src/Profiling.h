@@ -0,0 +1 @@
+#include "Profiling/Profiling.h"
\ No newline at end of file
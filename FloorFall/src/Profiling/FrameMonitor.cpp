@@ -0,0 +1,255 @@
+#include "FrameMonitor.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#if defined(FLOORFALL_FRAME_MONITOR)
+
+#if defined(__AVR__)
+// Provided by avr-libc's malloc.
+// '__brkval' is the end of the heap, or null if nothing has been allocated,
+// in which case the heap ends where it starts, at '__heap_start'.
+extern char __heap_start;
+extern char * __brkval;
+#endif
+
+namespace
+{
+	constexpr uint8_t stateCount = (static_cast<uint8_t>(GameState::GameplayState) + 1);
+
+	// How far below 'paintStack's own variables to stop painting,
+	// so as not to paint over anything else it has on the stack.
+	constexpr uint8_t paintMargin = 16;
+
+	// The last few frames of a state.
+	struct StateSamples
+	{
+		// The time each phase took, in microseconds.
+		uint16_t times[framePhaseCount][FrameMonitor::sampleCount];
+
+		// Where the next frame will be recorded.
+		uint8_t next;
+
+		// The number of frames recorded, up to 'sampleCount'.
+		uint8_t count;
+	};
+
+	StateSamples stateSamples[stateCount] {};
+
+	// The frame being timed.
+	uint8_t currentState { 0 };
+	uint8_t currentPhase { 0 };
+	uint32_t phaseStart { 0 };
+	uint16_t phaseTimes[framePhaseCount] {};
+
+	// When the last frame began, if there's been one.
+	uint32_t frameStart { 0 };
+	bool frameStarted { false };
+
+	uint16_t missedFrames { 0 };
+
+	// The free memory, as of the last frame the overlay was visible.
+	uint16_t freeMemory { 0 };
+
+	bool overlayVisible { false };
+
+	// The letters that the overlay labels each phase with, in the same order as 'FramePhase'.
+	constexpr char phaseLetters[] { 'P', 'U', 'R', 'D' };
+
+	static_assert(sizeof(phaseLetters) == framePhaseCount, "phaseLetters doesn't match FramePhase");
+
+	uint16_t addSaturated(uint16_t left, uint32_t right)
+	{
+		const uint32_t sum = (left + right);
+
+		return (sum < 0xFFFF) ? static_cast<uint16_t>(sum) : 0xFFFF;
+	}
+
+	// Charges the time since the last phase began to that phase.
+	void endPhase(uint32_t now)
+	{
+		phaseTimes[currentPhase] = addSaturated(phaseTimes[currentPhase], now - phaseStart);
+		phaseStart = now;
+	}
+
+	#if defined(__AVR__)
+	uint8_t * getHeapEnd()
+	{
+		return reinterpret_cast<uint8_t *>((__brkval != nullptr) ? __brkval : &__heap_start);
+	}
+	#endif
+
+	// Prints a number right-aligned in six characters,
+	// so that a shorter number fully covers a longer one.
+	void printPadded(Canvas & canvas, uint16_t value)
+	{
+		canvas.drawCharacter(' ');
+
+		for(uint16_t limit = 10000; (limit > 1) && (value < limit); limit /= 10)
+			canvas.drawCharacter(' ');
+
+		canvas.drawNumber(value);
+	}
+}
+
+void FrameMonitor::paintStack()
+{
+	#if defined(__AVR__)
+	// The stack grows down towards the heap,
+	// so everything from the end of the heap to just below here is unused.
+	volatile uint8_t marker = 0;
+
+	uint8_t * const end = (const_cast<uint8_t *>(&marker) - paintMargin);
+
+	for(uint8_t * address = getHeapEnd(); address < end; ++address)
+		*address = stackPaint;
+	#endif
+}
+
+uint16_t FrameMonitor::getFreeMemory()
+{
+	uint16_t count = 0;
+
+	#if defined(__AVR__)
+	// Anything the stack has reached will have been written over,
+	// so the paint that's left is memory that's never been needed.
+	for(const uint8_t * address = getHeapEnd(); *address == stackPaint; ++address)
+		++count;
+	#endif
+
+	return count;
+}
+
+void FrameMonitor::beginFrame(GameState state)
+{
+	const uint32_t now = micros();
+
+	// If this frame began more than half a frame late,
+	// every whole frame in between was missed.
+	if(frameStarted)
+	{
+		const uint32_t elapsed = (now - frameStart);
+
+		if(elapsed > (frameDuration + (frameDuration / 2)))
+			missedFrames = addSaturated(missedFrames, ((elapsed + (frameDuration / 2)) / frameDuration) - 1);
+	}
+
+	frameStarted = true;
+	frameStart = now;
+
+	currentState = static_cast<uint8_t>(state);
+	currentPhase = static_cast<uint8_t>(FramePhase::Poll);
+	phaseStart = now;
+
+	for(auto & time : phaseTimes)
+		time = 0;
+}
+
+void FrameMonitor::enter(FramePhase phase)
+{
+	endPhase(micros());
+
+	currentPhase = static_cast<uint8_t>(phase);
+}
+
+void FrameMonitor::endFrame()
+{
+	endPhase(micros());
+
+	auto & samples = stateSamples[currentState];
+
+	for(uint8_t phase = 0; phase < framePhaseCount; ++phase)
+		samples.times[phase][samples.next] = phaseTimes[phase];
+
+	samples.next = ((samples.next + 1) % sampleCount);
+
+	if(samples.count < sampleCount)
+		++samples.count;
+
+	// Scanning the paint takes a while, so only do it when it'll be seen.
+	if(overlayVisible)
+		freeMemory = getFreeMemory();
+}
+
+bool FrameMonitor::updateOverlay(Arduboy2Base & arduboy)
+{
+	if(!arduboy.pressed(A_BUTTON | B_BUTTON) || !arduboy.justPressed(DOWN_BUTTON))
+		return false;
+
+	overlayVisible = !overlayVisible;
+
+	if(overlayVisible)
+		freeMemory = getFreeMemory();
+
+	return true;
+}
+
+bool FrameMonitor::isOverlayVisible()
+{
+	return overlayVisible;
+}
+
+void FrameMonitor::renderOverlay(Canvas & canvas)
+{
+	if(!overlayVisible)
+		return;
+
+	const auto & samples = stateSamples[currentState];
+
+	// Leave the top line for the game's own messages.
+	int16_t y = Canvas::pageHeight;
+
+	canvas.setCursor(0, y);
+	canvas.drawText(F("    min   avg   max"));
+
+	for(uint8_t phase = 0; phase < framePhaseCount; ++phase)
+	{
+		uint16_t minimum = 0xFFFF;
+		uint16_t maximum = 0;
+		uint32_t total = 0;
+
+		for(uint8_t index = 0; index < samples.count; ++index)
+		{
+			const uint16_t time = samples.times[phase][index];
+
+			if(time < minimum)
+				minimum = time;
+
+			if(time > maximum)
+				maximum = time;
+
+			total += time;
+		}
+
+		y += Canvas::pageHeight;
+
+		canvas.setCursor(0, y);
+		canvas.drawCharacter(phaseLetters[phase]);
+		printPadded(canvas, (samples.count > 0) ? minimum : 0);
+		printPadded(canvas, (samples.count > 0) ? static_cast<uint16_t>(total / samples.count) : 0);
+		printPadded(canvas, maximum);
+	}
+
+	y += Canvas::pageHeight;
+
+	canvas.setCursor(0, y);
+	canvas.drawText(F("Miss"));
+	printPadded(canvas, missedFrames);
+	canvas.drawText(F(" Free"));
+	printPadded(canvas, freeMemory);
+}
+
+#endif
\ No newline at end of file
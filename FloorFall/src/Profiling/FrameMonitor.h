@@ -0,0 +1,123 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include <Arduboy2.h>
+
+#include "FramePhase.h"
+#include "../States/GameState.h"
+#include "../Rendering/Canvas.h"
+
+// Times each phase of every frame on the Arduboy itself,
+// and shows the results on an overlay.
+//
+// 'Profiler' needs a simulator, this doesn't,
+// so it shows what the real hardware does, and how close the stack
+// has come to running into everything else in RAM.
+//
+// When FLOORFALL_FRAME_MONITOR is defined, each phase is timed with 'micros'
+// and the last 'FrameMonitor::sampleCount' times of each phase are kept for each 'GameState',
+// along with the number of frames that were missed because a frame ran long.
+// Holding A and B and pressing down shows or hides the overlay,
+// which gives the minimum, average and maximum of each phase for the current state,
+// the frames missed, and the least free RAM seen so far.
+//
+// Otherwise this does nothing, and costs nothing.
+namespace FrameMonitor
+{
+	// The number of frames remembered for each state.
+	// The samples take 'sampleCount * framePhaseCount * 2' bytes per state.
+	constexpr uint8_t sampleCount = 8;
+
+	// The length of a frame at Arduboy2's default 60 frames per second,
+	// which the game doesn't change.
+	constexpr uint32_t frameDuration = (1000000 / 60);
+
+	// The value that the unused part of the stack is painted with.
+	constexpr uint8_t stackPaint = 0xA5;
+
+	#if defined(FLOORFALL_FRAME_MONITOR)
+
+	// Fills the memory between the end of the heap and the stack with 'stackPaint',
+	// so that 'getFreeMemory' can tell how much of it the stack has used since.
+	// Should be called as early as possible.
+	void paintStack();
+
+	// Returns the number of bytes that the stack has never reached since 'paintStack'.
+	// (Always 0 on a host build, which has no stack to measure.)
+	uint16_t getFreeMemory();
+
+	// Starts timing a frame of the given state, beginning with 'FramePhase::Poll'.
+	void beginFrame(GameState state);
+
+	// Starts timing a phase, ending the previous one.
+	void enter(FramePhase phase);
+
+	// Ends the last phase and records the frame.
+	void endFrame();
+
+	// Shows or hides the overlay if the buttons say so.
+	// Returns true if it did, in which case the screen needs redrawing.
+	bool updateOverlay(Arduboy2Base & arduboy);
+
+	// Determines whether the overlay is visible,
+	// in which case it changes every frame.
+	bool isOverlayVisible();
+
+	// Draws the overlay, if it's visible.
+	void renderOverlay(Canvas & canvas);
+
+	#else
+
+	inline void paintStack()
+	{
+	}
+
+	inline void beginFrame(GameState state)
+	{
+		static_cast<void>(state);
+	}
+
+	inline void enter(FramePhase phase)
+	{
+		static_cast<void>(phase);
+	}
+
+	inline void endFrame()
+	{
+	}
+
+	inline bool updateOverlay(Arduboy2Base & arduboy)
+	{
+		static_cast<void>(arduboy);
+		return false;
+	}
+
+	inline bool isOverlayVisible()
+	{
+		return false;
+	}
+
+	inline void renderOverlay(Canvas & canvas)
+	{
+		static_cast<void>(canvas);
+	}
+
+	#endif
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+// The parts of a frame that 'FrameMonitor' times.
+enum class FramePhase : uint8_t
+{
+	// Reading the buttons.
+	Poll,
+
+	// Updating the current state.
+	Update,
+
+	// Clearing the screen and rendering the current state.
+	// (When the screen is streamed, this includes sending it to the display.)
+	Render,
+
+	// Sending the screen buffer to the display.
+	Display,
+};
+
+// The number of phases.
+constexpr uint8_t framePhaseCount = (static_cast<uint8_t>(FramePhase::Display) + 1);
\ No newline at end of file
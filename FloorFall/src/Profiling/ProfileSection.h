@@ -0,0 +1,49 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+// The parts of a frame that the profiler tells apart.
+// (The profiler names them by these values, so keep 'Tools/Profiler' in step.)
+enum class ProfileSection : uint8_t
+{
+	// Waiting for the next frame.
+	Idle,
+
+	// The rest of 'Game::loop'.
+	// (Polling the buttons, clearing the screen and sending it to the display.)
+	Frame,
+
+	SplashscreenUpdate,
+	SplashscreenRender,
+
+	TitlescreenUpdate,
+	TitlescreenRender,
+
+	LevelSelectUpdate,
+	LevelSelectRender,
+
+	GameplayUpdate,
+	GameplayRender,
+
+	// The part of 'GameplayUpdate' spent searching for a hint.
+	HintSearch,
+};
+
+// The number of sections.
+constexpr uint8_t profileSectionCount = (static_cast<uint8_t>(ProfileSection::HintSearch) + 1);
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+#include "ProfileSection.h"
+
+#if defined(FLOORFALL_PROFILE)
+// For GPIOR0
+#include <avr/io.h>
+#endif
+
+// Marks where each section of a frame begins,
+// so that a simulator can measure how long each one takes.
+//
+// When FLOORFALL_PROFILE is defined, entering a section writes
+// its number to GPIOR0, a general purpose register that nothing else uses.
+// That's a single 'out' instruction, so it barely disturbs what's being measured.
+// 'floorfall-profiler' runs the game under simavr, watches that register,
+// and charges the cycles between writes to the section that was entered.
+//
+// Otherwise this does nothing, and costs nothing.
+namespace Profiler
+{
+	inline void enter(ProfileSection section)
+	{
+		#if defined(FLOORFALL_PROFILE)
+		GPIOR0 = static_cast<uint8_t>(section);
+		#else
+		static_cast<void>(section);
+		#endif
+	}
+}
\ No newline at end of file
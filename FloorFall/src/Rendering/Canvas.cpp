@@ -0,0 +1,323 @@
+#include "Canvas.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For memset
+#include <string.h>
+
+// For assert
+#if defined(DEBUG)
+#include <assert.h>
+#endif
+
+// For memcpy_P, pgm_read_byte
+#include <avr/pgmspace.h>
+
+#include "../Images.h"
+
+#include "ImageCodec.h"
+
+namespace
+{
+	const uint8_t * getGlyph(uint8_t character)
+	{
+		uint8_t index = Images::fontUnknown;
+
+		if((character >= Images::fontFirstCharacter) && (character <= Images::fontLastCharacter))
+			index = (character - Images::fontFirstCharacter);
+		else if(character == Images::fontRightTriangleCharacter)
+			index = Images::fontRightTriangle;
+
+		return &Images::font[index * Images::fontGlyphWidth];
+	}
+
+	// The decimal digits of every number under 100,
+	// tens in the upper four bits and units in the lower.
+	constexpr uint8_t decimalDigits[] PROGMEM
+	{
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+		0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+		0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+		0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+		0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+		0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+		0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+		0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+		0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+	};
+}
+
+void Canvas::clear()
+{
+	memset(this->buffer, 0, (this->pageCount * WIDTH));
+}
+
+void Canvas::drawBits(int16_t page, int16_t x, uint8_t bits, uint8_t mask, DrawMode mode)
+{
+	const int16_t index = (page - this->firstPage);
+
+	if((index < 0) || (index >= this->pageCount))
+		return;
+
+	uint8_t & byte = this->buffer[(index * WIDTH) + x];
+
+	switch(mode)
+	{
+		case DrawMode::Overwrite:
+			byte = static_cast<uint8_t>((byte & ~mask) | bits);
+			break;
+
+		case DrawMode::SelfMasked:
+			byte |= bits;
+			break;
+	}
+}
+
+void Canvas::drawColumn(int16_t x, int16_t y, uint8_t bits, DrawMode mode)
+{
+	if((x < 0) || (x >= WIDTH))
+		return;
+
+	// A column that isn't aligned to a page straddles two pages.
+	// (Masking with 7 and subtracting rounds towards negative infinity,
+	// which matters for columns that hang off of the top of the screen.)
+	const uint8_t shift = static_cast<uint8_t>(y & 7);
+	const int16_t upperPage = ((y - shift) / pageHeight);
+
+	this->drawBits(upperPage, x, static_cast<uint8_t>(bits << shift), static_cast<uint8_t>(0xFF << shift), mode);
+
+	if(shift != 0)
+		this->drawBits(upperPage + 1, x, static_cast<uint8_t>(bits >> (8 - shift)), static_cast<uint8_t>(0xFF >> (8 - shift)), mode);
+}
+
+void Canvas::drawFrame(int16_t x, int16_t y, const uint8_t * frame, uint8_t width, DrawMode mode)
+{
+	if(!this->coversRows(y, pageHeight))
+		return;
+
+	// If the frame sits entirely within one page of the canvas,
+	// and replaces whatever is beneath it...
+	if((mode == DrawMode::Overwrite) && ((y & 7) == 0) && (x >= 0) && (x <= (WIDTH - width)))
+	{
+		// Copy it straight into the buffer.
+		const int16_t index = ((y / pageHeight) - this->firstPage);
+		memcpy_P(&this->buffer[(index * WIDTH) + x], frame, width);
+		return;
+	}
+
+	for(uint8_t column = 0; column < width; ++column)
+		this->drawColumn(x + column, y, pgm_read_byte(&frame[column]), mode);
+}
+
+void Canvas::fillRect(int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+	// Fill up to eight rows at a time,
+	// a column at a time, leaving the pixels around them alone.
+	for(uint8_t top = 0; top < height; top += pageHeight)
+	{
+		const uint8_t rows = ((height - top) < pageHeight) ? (height - top) : pageHeight;
+
+		if(!this->coversRows(y + top, rows))
+			continue;
+
+		const uint8_t bits = static_cast<uint8_t>((1u << rows) - 1);
+
+		for(uint8_t column = 0; column < width; ++column)
+			this->drawColumn(x + column, y + top, bits, DrawMode::SelfMasked);
+	}
+}
+
+void Canvas::drawSprite(int16_t x, int16_t y, const uint8_t * sprite, uint8_t frame, DrawMode mode)
+{
+	const uint8_t width = pgm_read_byte(&sprite[0]);
+	const uint8_t height = pgm_read_byte(&sprite[1]);
+	const uint8_t pages = ((height + 7) / pageHeight);
+
+	const uint8_t * data = &sprite[2 + (frame * width * pages)];
+
+	for(uint8_t page = 0; page < pages; ++page)
+		this->drawFrame(x, y + (page * pageHeight), &data[page * width], width, mode);
+}
+
+void Canvas::drawCompressedImage(int16_t x, int16_t y, const uint8_t * image)
+{
+	const uint8_t width = pgm_read_byte(&image[0]);
+	const uint8_t height = pgm_read_byte(&image[1]);
+	const uint8_t pages = ((height + 7) / pageHeight);
+
+	// If debugging is enabled, check that every run lands in one piece.
+	#if defined(DEBUG)
+	assert((y & 7) == 0);
+	assert((x >= 0) && ((x + width) <= WIDTH));
+	#endif
+
+	const uint8_t * data = &image[2];
+
+	for(uint8_t page = 0; page < pages; ++page)
+	{
+		const int16_t index = (((y / pageHeight) + page) - this->firstPage);
+
+		// A page that the canvas doesn't cover still has to be read past,
+		// but nothing is drawn.
+		uint8_t * row = ((index >= 0) && (index < this->pageCount)) ? &this->buffer[(index * WIDTH) + x] : nullptr;
+
+		for(uint8_t column = 0; column < width;)
+		{
+			const uint8_t tag = pgm_read_byte(data);
+			++data;
+
+			uint8_t length;
+
+			// If the run is a literal...
+			if((tag & ImageCodec::repeatFlag) == 0)
+			{
+				length = ((tag & ImageCodec::literalLengthMask) + 1);
+
+				if(row != nullptr)
+					memcpy_P(&row[column], data, length);
+
+				data += length;
+			}
+			// Otherwise, if the run is a fill...
+			else if((tag & ImageCodec::copyFlag) == 0)
+			{
+				length = ((tag & ImageCodec::repeatLengthMask) + ImageCodec::minimumFill);
+
+				if(row != nullptr)
+					memset(&row[column], pgm_read_byte(data), length);
+
+				++data;
+			}
+			// Otherwise the run is a copy.
+			else
+			{
+				length = ((tag & ImageCodec::repeatLengthMask) + ImageCodec::minimumCopy);
+
+				const uint8_t distance = pgm_read_byte(data);
+				++data;
+
+				// The source and the destination may overlap,
+				// so this has to go a byte at a time, from the front.
+				if(row != nullptr)
+					for(uint8_t offset = 0; offset < length; ++offset)
+						row[column + offset] = row[(column + offset) - distance];
+			}
+
+			column += length;
+		}
+	}
+}
+
+void Canvas::drawCharacter(uint8_t character)
+{
+	// Carriage returns are ignored and line feeds start a new line,
+	// as with Arduboy2.
+	if(character == '\r')
+		return;
+
+	if(character == '\n')
+	{
+		this->cursorX = 0;
+		this->cursorY += Images::fontCellHeight;
+		return;
+	}
+
+	// Characters on other pages only move the cursor.
+	if(this->coversRows(this->cursorY, Images::fontCellHeight))
+	{
+		const uint8_t * glyph = getGlyph(character);
+
+		// If the whole cell is on one page, as text almost always is,
+		// copy the glyph's columns straight into the buffer.
+		if(((this->cursorY & 7) == 0) && (this->cursorX >= 0) && (this->cursorX <= (WIDTH - Images::fontCellWidth)))
+		{
+			uint8_t * cell = &this->buffer[(((this->cursorY / pageHeight) - this->firstPage) * WIDTH) + this->cursorX];
+
+			memcpy_P(cell, glyph, Images::fontGlyphWidth);
+
+			// The gap between characters is background too.
+			cell[Images::fontGlyphWidth] = 0;
+		}
+		else
+		{
+			this->drawFrame(this->cursorX, this->cursorY, glyph, Images::fontGlyphWidth, DrawMode::Overwrite);
+			this->drawColumn(this->cursorX + Images::fontGlyphWidth, this->cursorY, 0, DrawMode::Overwrite);
+		}
+	}
+
+	this->cursorX += Images::fontCellWidth;
+}
+
+void Canvas::drawText(FlashString string)
+{
+	const char * pointer = static_cast<const char *>(string);
+
+	for(char character = pgm_read_byte(pointer); character != '\0'; character = pgm_read_byte(++pointer))
+		this->drawCharacter(character);
+}
+
+void Canvas::drawText(const KnownSizeFlashString & string)
+{
+	// The size is known, so there's no need to look for the terminator.
+	for(size_t index = 0; index < string.size(); ++index)
+		this->drawCharacter(string[index]);
+}
+
+void Canvas::drawNumber(uint16_t value)
+{
+	// Only numbers of four digits or more need dividing,
+	// and then only once for every two digits past the first two.
+	if(value >= 1000)
+	{
+		this->drawNumber(value / 100);
+		this->drawDigits(pgm_read_byte(&decimalDigits[value % 100]));
+		return;
+	}
+
+	// Otherwise there are at most nine hundreds to take away,
+	// and the table has the rest.
+	uint8_t hundreds = 0;
+
+	while(value >= 100)
+	{
+		value -= 100;
+		++hundreds;
+	}
+
+	const uint8_t digits = pgm_read_byte(&decimalDigits[value]);
+
+	// Leading zeroes are left off.
+	if(hundreds > 0)
+	{
+		this->drawCharacter('0' + hundreds);
+		this->drawDigits(digits);
+	}
+	else
+	{
+		if(digits >= 0x10)
+			this->drawCharacter('0' + (digits >> 4));
+
+		this->drawCharacter('0' + (digits & 0x0F));
+	}
+}
+
+void Canvas::drawDigits(uint8_t digits)
+{
+	this->drawCharacter('0' + (digits >> 4));
+	this->drawCharacter('0' + (digits & 0x0F));
+}
\ No newline at end of file
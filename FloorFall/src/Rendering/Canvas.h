@@ -0,0 +1,166 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include <stdint.h>
+#include <stddef.h>
+
+// For Print, WIDTH and HEIGHT
+#include <Arduboy2.h>
+
+#include "../Flash/Flash.h"
+
+enum class DrawMode : uint8_t
+{
+	// Every pixel of the image replaces the one beneath it.
+	Overwrite,
+
+	// Only the lit pixels of the image are drawn.
+	SelfMasked,
+};
+
+// Something to draw into: some run of whole pages of the screen.
+//
+// A canvas over all eight pages of Arduboy2's buffer draws the whole screen at once.
+// A canvas over a single page lets the screen be built up a page at a time
+// in a buffer of just 'WIDTH' bytes, and each page sent to the display as soon as it's done.
+// Anything outside of the canvas's pages is clipped,
+// so the same drawing code works either way.
+//
+// It's also a 'Print', and its text is drawn just as Arduboy2's is:
+// each character fills a 6x8 cell, background included.
+// The 'draw' functions for text skip 'Print' and its virtual 'write' altogether,
+// and a character on a page boundary is copied straight into the buffer.
+class Canvas final : public Print
+{
+public:
+	static constexpr uint8_t pageHeight = 8;
+	static constexpr uint8_t screenPages = (HEIGHT / pageHeight);
+
+private:
+	uint8_t * buffer { nullptr };
+	uint8_t firstPage { 0 };
+	uint8_t pageCount { 0 };
+
+	int16_t cursorX { 0 };
+	int16_t cursorY { 0 };
+
+public:
+	Canvas() = default;
+
+	Canvas(uint8_t * buffer, uint8_t firstPage, uint8_t pageCount) :
+		buffer { buffer }, firstPage { firstPage }, pageCount { pageCount }
+	{
+	}
+
+	uint8_t * getBuffer() const
+	{
+		return this->buffer;
+	}
+
+	// The first row of the screen that the canvas covers.
+	int16_t getTop() const
+	{
+		return (this->firstPage * pageHeight);
+	}
+
+	// The row of the screen just below the canvas.
+	int16_t getBottom() const
+	{
+		return ((this->firstPage + this->pageCount) * pageHeight);
+	}
+
+	// Determines whether anything drawn between
+	// 'y' and 'y + height' would land on the canvas.
+	bool coversRows(int16_t y, uint8_t height) const
+	{
+		return ((y < this->getBottom()) && ((y + height) > this->getTop()));
+	}
+
+	// Clears the canvas to black.
+	void clear();
+
+	void setCursor(int16_t x, int16_t y)
+	{
+		this->cursorX = x;
+		this->cursorY = y;
+	}
+
+	// Draws a column of eight pixels, least significant bit at the top.
+	void drawColumn(int16_t x, int16_t y, uint8_t bits, DrawMode mode);
+
+	// Draws eight pixel tall image data from progmem, one byte per column.
+	void drawFrame(int16_t x, int16_t y, const uint8_t * frame, uint8_t width, DrawMode mode);
+
+	// Lights every pixel of a rectangle.
+	void fillRect(int16_t x, int16_t y, uint8_t width, uint8_t height);
+
+	// Draws a frame of an image in the format that 'Sprites' uses.
+	void drawSprite(int16_t x, int16_t y, const uint8_t * sprite, uint8_t frame, DrawMode mode);
+
+	// Draws an image in the format described by 'ImageCodec', replacing whatever is beneath it.
+	// The image must lie entirely within the width of the screen,
+	// and 'y' must be a multiple of eight.
+	void drawCompressedImage(int16_t x, int16_t y, const uint8_t * image);
+
+	// Draws a character at the cursor and moves the cursor along,
+	// as 'write' does, but without going through 'Print'.
+	void drawCharacter(uint8_t character);
+
+	// Draws a string from progmem at the cursor.
+	void drawText(FlashString string);
+
+	// Draws a string from progmem at the cursor.
+	// (For the result of the 'F' macro.)
+	void drawText(FlashStringHelper string)
+	{
+		this->drawText(FlashString(reinterpret_cast<const char *>(string)));
+	}
+
+	// Draws a string from progmem at the cursor.
+	void drawText(const KnownSizeFlashString & string);
+
+	// Draws a compressed string at the cursor, decoding it along the way.
+	void drawText(const CompressedFlashString & string)
+	{
+		// 'write' can't be overridden any further,
+		// so this goes straight to 'drawCharacter'.
+		string.writeTo(*this);
+	}
+
+	// Draws a number in decimal at the cursor.
+	// Anything under 1000 is formatted without dividing,
+	// which covers level numbers, move counts and map sizes.
+	void drawNumber(uint16_t value);
+
+	using Print::write;
+
+	size_t write(uint8_t character) override
+	{
+		this->drawCharacter(character);
+		return 1;
+	}
+
+private:
+	// Combines some bits into one byte of the given page,
+	// if that page is part of the canvas.
+	void drawBits(int16_t page, int16_t x, uint8_t bits, uint8_t mask, DrawMode mode);
+
+	// Draws a pair of decimal digits, given as binary-coded decimal.
+	void drawDigits(uint8_t digits);
+};
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include <stdint.h>
+
+// The format of the compressed images that 'Canvas::drawCompressedImage' draws,
+// shared with 'floorfall-imagec', which makes them.
+//
+// An image starts with its width and height, as a 'Sprites' image does.
+// The rest is each page of the image in turn, top to bottom,
+// with the columns of a page written as a series of runs.
+// A run never carries on from one page into the next.
+//
+// Each run starts with a tag byte, which says what kind of run it is and how long:
+//   0lllllll                - 'l + 1' literal bytes follow.
+//   10llllll VALUE          - 'l + minimumFill' copies of VALUE.
+//   11llllll DISTANCE       - 'l + minimumCopy' bytes copied from DISTANCE columns
+//                             further back in the same page, one at a time.
+//                             (So a DISTANCE shorter than the run repeats a pattern.)
+//
+// Every run decodes straight into the screen buffer.
+// A copy reads back the columns that have already been drawn,
+// so there's no need for any buffer of its own.
+// Title screens and logos are mostly empty space, straight lines
+// and repeating patterns, which fills and copies suit well.
+namespace ImageCodec
+{
+	// The tag bit that marks a fill or a copy.
+	constexpr uint8_t repeatFlag = 0x80;
+
+	// The tag bit that marks a copy rather than a fill.
+	constexpr uint8_t copyFlag = 0x40;
+
+	constexpr uint8_t literalLengthMask = 0x7F;
+	constexpr uint8_t repeatLengthMask = 0x3F;
+
+	// The shortest runs worth encoding.
+	// (Anything shorter takes fewer bytes as literals.)
+	constexpr uint8_t minimumFill = 3;
+	constexpr uint8_t minimumCopy = 3;
+
+	constexpr uint8_t maximumLiteral = (literalLengthMask + 1);
+	constexpr uint8_t maximumFill = (repeatLengthMask + minimumFill);
+	constexpr uint8_t maximumCopy = (repeatLengthMask + minimumCopy);
+
+	// The furthest back a copy can reach.
+	constexpr uint8_t maximumDistance = 0xFF;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include <stdint.h>
+
+#include "TileAnimationType.h"
+
+// An animation playing on a tile of the board.
+struct TileAnimation
+{
+	// The position of the tile on the board.
+	uint8_t x;
+	uint8_t y;
+
+	// The animation being played.
+	TileAnimationType type;
+
+	// The frame being shown.
+	uint8_t frame;
+
+	// The updates left before the next frame.
+	uint8_t timer;
+};
+
+// The animations that are playing.
+//
+// Only a handful of tiles are ever animating at once,
+// so rather than give every tile of the board its own animation state
+// and scan the whole board to find the ones that are animating,
+// just those few are kept in a small list.
+// Updating and drawing the animations then costs time
+// only for the tiles that are actually animating.
+//
+// The order of the list isn't kept.
+class TileAnimationList
+{
+public:
+	// The most animations that can play at once.
+	static constexpr uint8_t capacity = 8;
+
+private:
+	TileAnimation animations[capacity] {};
+	uint8_t count { 0 };
+
+public:
+	bool isEmpty() const
+	{
+		return (this->count == 0);
+	}
+
+	bool isFull() const
+	{
+		return (this->count >= capacity);
+	}
+
+	uint8_t getCount() const
+	{
+		return this->count;
+	}
+
+	TileAnimation & operator[](uint8_t index)
+	{
+		return this->animations[index];
+	}
+
+	const TileAnimation & operator[](uint8_t index) const
+	{
+		return this->animations[index];
+	}
+
+	// Returns the index of the animation playing on a tile,
+	// or the count if there isn't one.
+	uint8_t find(uint8_t x, uint8_t y) const
+	{
+		for(uint8_t index = 0; index < this->count; ++index)
+			if((this->animations[index].x == x) && (this->animations[index].y == y))
+				return index;
+
+		return this->count;
+	}
+
+	// Starts an animation on a tile, from its first frame,
+	// replacing any animation already playing on that tile.
+	// Unless there's already an animation on that tile,
+	// the list must not be full.
+	void start(uint8_t x, uint8_t y, TileAnimationType type, uint8_t frameDuration)
+	{
+		const uint8_t index = this->find(x, y);
+
+		if(index == this->count)
+			++this->count;
+
+		this->animations[index] = TileAnimation { x, y, type, 0, frameDuration };
+	}
+
+	// Removes an animation.
+	// The last animation takes its place.
+	void remove(uint8_t index)
+	{
+		--this->count;
+		this->animations[index] = this->animations[this->count];
+	}
+
+	// Removes every animation.
+	void clear()
+	{
+		this->count = 0;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include <stdint.h>
+
+// The ways a tile can be animated.
+// Each one is played once, over the top of the tile,
+// and then the tile is drawn as usual again.
+enum class TileAnimationType : uint8_t
+{
+	// A broken tile losing a step.
+	Crumble,
+
+	// A broken tile with no steps left falling away.
+	Fall,
+
+	// A button being turned on.
+	Press,
+
+	// A button being turned off.
+	Release,
+};
+
+// The number of animation types.
+constexpr uint8_t tileAnimationTypeCount = (static_cast<uint8_t>(TileAnimationType::Release) + 1);
\ No newline at end of file
@@ -0,0 +1,168 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdint.h>
+
+// For PROGMEM, pgm_read_ptr, pgm_read_byte
+#include <avr/pgmspace.h>
+
+#include "../Logic/Tile.h"
+#include "../Images.h"
+
+#include "Canvas.h"
+#include "TileAnimationType.h"
+
+// Draws board tiles.
+//
+// Every tile image is 8x8, so a tile drawn at a 'y' that's a multiple of 8
+// covers exactly one byte in each of eight columns of a single page.
+// 'Canvas::drawFrame' copies such a tile straight out of progmem,
+// with none of the shifting and masking that 'Sprites::drawOverwrite'
+// has to do to cope with sprites of any size at any position.
+// Every tile on the board is drawn that way, so only a tile
+// that's partly off screen or between pages needs the slower path.
+namespace TileRenderer
+{
+	constexpr uint8_t tileWidth = 8;
+	constexpr uint8_t tileHeight = 8;
+
+	static_assert((Images::brokenTileWidth == tileWidth) && (Images::brokenTileHeight == tileHeight), "brokenTile must be 8x8");
+	static_assert((Images::solidTileWidth == tileWidth) && (Images::solidTileHeight == tileHeight), "solidTile must be 8x8");
+	static_assert((Images::buttonTileWidth == tileWidth) && (Images::buttonTileHeight == tileHeight), "buttonTile must be 8x8");
+	static_assert((Images::brokenTileCrumbleWidth == tileWidth) && (Images::brokenTileCrumbleHeight == tileHeight), "brokenTileCrumble must be 8x8");
+	static_assert((Images::brokenTileFallWidth == tileWidth) && (Images::brokenTileFallHeight == tileHeight), "brokenTileFall must be 8x8");
+	static_assert((Images::buttonTilePressWidth == tileWidth) && (Images::buttonTilePressHeight == tileHeight), "buttonTilePress must be 8x8");
+	static_assert((Images::buttonTileReleaseWidth == tileWidth) && (Images::buttonTileReleaseHeight == tileHeight), "buttonTileRelease must be 8x8");
+
+	// The frames that a type of tile is drawn with.
+	// The tile's parameter selects the frame.
+	struct TileImage
+	{
+		const uint8_t * frames;
+		uint8_t frameCount;
+	};
+
+	// The frames of an image, skipping its dimensions.
+	constexpr const uint8_t * getFrames(const uint8_t * image)
+	{
+		return &image[2];
+	}
+
+	// The images for each type of tile, indexed by 'TileType'.
+	// A type without an image maps to nullptr and isn't drawn.
+	//
+	// This replaces a 'switch' on the tile's type,
+	// which costs a chain of comparisons.
+	constexpr TileImage tileImages[] PROGMEM
+	{
+		// TileType::Broken
+		{ getFrames(Images::brokenTile), Images::brokenTileFrameCount },
+
+		// TileType::Solid
+		{ getFrames(Images::solidTile), Images::solidTileFrameCount },
+
+		// TileType::Button
+		{ getFrames(Images::buttonTile), Images::buttonTileFrameCount },
+
+		// Unused type
+		{ nullptr, 0 },
+	};
+
+	// A map stores two bits for the type,
+	// so no tile can fall outside of the table.
+	constexpr uint8_t getImageIndex(Tile tile)
+	{
+		return (static_cast<uint8_t>(tile.getType()) & 0x03);
+	}
+
+	static_assert((sizeof(tileImages) / sizeof(tileImages[0])) == 4, "tileImages must cover every tile type");
+
+	// A tile without a frame isn't drawn at all,
+	// so a broken tile with more steps than this would be invisible.
+	static_assert(Images::brokenTileFrameCount == (Tile::maximumSteps + 1), "There must be a broken tile frame for every number of steps");
+
+	// Gets the frame that a tile is drawn with,
+	// or nullptr if there isn't one.
+	inline const uint8_t * getTileFrame(Tile tile)
+	{
+		const auto & image = tileImages[getImageIndex(tile)];
+
+		const auto frames = static_cast<const uint8_t *>(pgm_read_ptr(&image.frames));
+		const uint8_t frameCount = pgm_read_byte(&image.frameCount);
+
+		const uint8_t parameter = tile.getParameter();
+
+		if(parameter >= frameCount)
+			return nullptr;
+
+		return &frames[parameter * tileWidth];
+	}
+
+	inline void drawTile(Canvas & canvas, Tile tile, int16_t x, int16_t y)
+	{
+		const uint8_t * frame = getTileFrame(tile);
+
+		if(frame != nullptr)
+			canvas.drawFrame(x, y, frame, tileWidth, DrawMode::Overwrite);
+	}
+
+	// The frames of an animation,
+	// and how many updates each frame is shown for.
+	struct AnimationImage
+	{
+		const uint8_t * frames;
+		uint8_t frameCount;
+		uint8_t frameDuration;
+	};
+
+	// The images for each animation, indexed by 'TileAnimationType'.
+	constexpr AnimationImage animationImages[] PROGMEM
+	{
+		// TileAnimationType::Crumble
+		{ getFrames(Images::brokenTileCrumble), Images::brokenTileCrumbleFrameCount, 4 },
+
+		// TileAnimationType::Fall
+		{ getFrames(Images::brokenTileFall), Images::brokenTileFallFrameCount, 5 },
+
+		// TileAnimationType::Press
+		{ getFrames(Images::buttonTilePress), Images::buttonTilePressFrameCount, 3 },
+
+		// TileAnimationType::Release
+		{ getFrames(Images::buttonTileRelease), Images::buttonTileReleaseFrameCount, 3 },
+	};
+
+	static_assert((sizeof(animationImages) / sizeof(animationImages[0])) == tileAnimationTypeCount, "animationImages must cover every animation type");
+
+	inline uint8_t getAnimationFrameCount(TileAnimationType type)
+	{
+		return pgm_read_byte(&animationImages[static_cast<uint8_t>(type)].frameCount);
+	}
+
+	inline uint8_t getAnimationFrameDuration(TileAnimationType type)
+	{
+		return pgm_read_byte(&animationImages[static_cast<uint8_t>(type)].frameDuration);
+	}
+
+	// Draws a frame of an animation in place of a tile.
+	inline void drawAnimationFrame(Canvas & canvas, TileAnimationType type, uint8_t frame, int16_t x, int16_t y)
+	{
+		const auto frames = static_cast<const uint8_t *>(pgm_read_ptr(&animationImages[static_cast<uint8_t>(type)].frames));
+
+		canvas.drawFrame(x, y, &frames[frame * tileWidth], tileWidth, DrawMode::Overwrite);
+	}
+}
\ No newline at end of file
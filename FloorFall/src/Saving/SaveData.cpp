@@ -0,0 +1,152 @@
+#include "SaveData.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include "../Settings.h"
+
+void SaveData::load()
+{
+	// Start from a new game's progress.
+	for(uint16_t level = 0; level < levelCount; ++level)
+		this->bestMoves[level] = noBestMoves;
+
+	this->selectedIndex = 0;
+	this->language = Settings::defaultLanguage;
+
+	// Then apply whatever has been saved.
+	this->journal.begin();
+
+	for(uint16_t keyIndex = 0; keyIndex < saveKeyCount; ++keyIndex)
+	{
+		SaveRecord record;
+
+		if(this->journal.readCurrentRecord(keyIndex, record))
+			this->apply(record);
+	}
+
+	// What's in RAM is now what's in EEPROM.
+	for(uint8_t index = 0; index < dirtyGroupBytes; ++index)
+		this->dirtyGroups[index] = 0;
+
+	this->selectedIndexDirty = false;
+	this->languageDirty = false;
+}
+
+void SaveData::apply(const SaveRecord & record)
+{
+	// Records about levels or values that don't exist
+	// were saved by a different version of the game, so they're ignored.
+	switch(record.type)
+	{
+		case SaveRecordType::LevelResults:
+			if(record.key < groupCount)
+				for(uint8_t index = 0; index < levelsPerGroup; ++index)
+				{
+					const uint16_t level = ((record.key * levelsPerGroup) + index);
+
+					if(level < levelCount)
+						this->bestMoves[level] = record.data[index];
+				}
+			break;
+
+		case SaveRecordType::SelectedLevel:
+		{
+			const uint16_t index = static_cast<uint16_t>(record.data[0] | (record.data[1] << 8));
+
+			if((record.key == 0) && (index < levelCount))
+				this->selectedIndex = index;
+			break;
+		}
+
+		case SaveRecordType::Language:
+			if((record.key == 0) && (record.data[0] < languageCount))
+				this->language = static_cast<Language>(record.data[0]);
+			break;
+	}
+}
+
+void SaveData::save()
+{
+	for(uint8_t group = 0; group < groupCount; ++group)
+	{
+		if(!this->isGroupDirty(group))
+			continue;
+
+		SaveRecord record { SaveRecordType::LevelResults, group, {} };
+
+		// A group past the last level is padded out with levels that haven't been completed.
+		for(uint8_t index = 0; index < levelsPerGroup; ++index)
+		{
+			const uint16_t level = ((group * levelsPerGroup) + index);
+
+			record.data[index] = (level < levelCount) ? this->bestMoves[level] : noBestMoves;
+		}
+
+		this->journal.append(record);
+	}
+
+	if(this->selectedIndexDirty)
+		this->journal.append(SaveRecord { SaveRecordType::SelectedLevel, 0, { static_cast<uint8_t>(this->selectedIndex & 0xFF), static_cast<uint8_t>(this->selectedIndex >> 8) } });
+
+	if(this->languageDirty)
+		this->journal.append(SaveRecord { SaveRecordType::Language, 0, { static_cast<uint8_t>(this->language) } });
+
+	for(uint8_t index = 0; index < dirtyGroupBytes; ++index)
+		this->dirtyGroups[index] = 0;
+
+	this->selectedIndexDirty = false;
+	this->languageDirty = false;
+}
+
+bool SaveData::hasChanges() const
+{
+	for(uint8_t index = 0; index < dirtyGroupBytes; ++index)
+		if(this->dirtyGroups[index] != 0)
+			return true;
+
+	return (this->selectedIndexDirty || this->languageDirty);
+}
+
+void SaveData::recordCompletion(uint16_t level, uint16_t moves)
+{
+	const uint8_t clampedMoves = (moves < maximumBestMoves) ? static_cast<uint8_t>(moves) : maximumBestMoves;
+
+	// Only a better result is worth saving.
+	if(clampedMoves >= this->bestMoves[level])
+		return;
+
+	this->bestMoves[level] = clampedMoves;
+	this->markLevelDirty(level);
+}
+
+void SaveData::setSelectedIndex(uint16_t index)
+{
+	if(index == this->selectedIndex)
+		return;
+
+	this->selectedIndex = index;
+	this->selectedIndexDirty = true;
+}
+
+void SaveData::setLanguage(Language language)
+{
+	if(language == this->language)
+		return;
+
+	this->language = language;
+	this->languageDirty = true;
+}
\ No newline at end of file
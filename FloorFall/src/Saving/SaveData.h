@@ -0,0 +1,135 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+#include "../Language.h"
+#include "../Levels.h"
+
+#include "SaveJournal.h"
+
+// The player's progress, as kept in RAM.
+//
+// Changes are only noted here, and nothing is written to EEPROM
+// until 'save' is called, which the game only does when changing state.
+// Writing EEPROM takes milliseconds per byte,
+// so doing it in the middle of play would drop frames,
+// and saving several changes at once means fewer writes.
+class SaveData
+{
+public:
+	// The best move count of a level that hasn't been completed.
+	static constexpr uint8_t noBestMoves = 0xFF;
+
+	// Move counts above this are saved as this.
+	static constexpr uint8_t maximumBestMoves = (noBestMoves - 1);
+
+private:
+	static constexpr uint16_t levelCount = Levels::levelCount;
+
+	// The levels' results are saved a group of levels at a time,
+	// one record per group.
+	static constexpr uint8_t levelsPerGroup = saveRecordDataSize;
+
+	static constexpr uint16_t groupCount = saveLevelGroupCount;
+
+	static constexpr uint8_t dirtyGroupBytes = ((groupCount + 7) / 8);
+
+private:
+	// The fewest moves each level has been completed in.
+	uint8_t bestMoves[levelCount];
+
+	// The level last selected on the level select menu.
+	uint16_t selectedIndex { 0 };
+
+	// The language the game's text is shown in.
+	Language language;
+
+	// Which groups of levels have results that haven't been saved yet.
+	// One bit per group.
+	uint8_t dirtyGroups[dirtyGroupBytes] {};
+
+	// Whether the selected level hasn't been saved yet.
+	bool selectedIndexDirty { false };
+
+	// Whether the language hasn't been saved yet.
+	bool languageDirty { false };
+
+	SaveJournal journal {};
+
+public:
+	// Reads the progress from EEPROM.
+	// Anything that hasn't been saved before is left as a new game's.
+	void load();
+
+	// Writes whatever has changed since the last save to EEPROM.
+	void save();
+
+	// Determines whether anything has changed since the last save.
+	bool hasChanges() const;
+
+	// Determines whether a level has been completed.
+	bool isCompleted(uint16_t level) const
+	{
+		return (this->bestMoves[level] != noBestMoves);
+	}
+
+	// Returns the fewest moves a level has been completed in,
+	// or 'noBestMoves' if it hasn't been completed.
+	uint8_t getBestMoves(uint16_t level) const
+	{
+		return this->bestMoves[level];
+	}
+
+	// Notes that a level was completed,
+	// keeping the move count if it's the best yet.
+	void recordCompletion(uint16_t level, uint16_t moves);
+
+	uint16_t getSelectedIndex() const
+	{
+		return this->selectedIndex;
+	}
+
+	// Notes which level is selected on the level select menu.
+	void setSelectedIndex(uint16_t index);
+
+	Language getLanguage() const
+	{
+		return this->language;
+	}
+
+	// Notes which language the player picked.
+	void setLanguage(Language language);
+
+private:
+	bool isGroupDirty(uint8_t group) const
+	{
+		return ((this->dirtyGroups[group / 8] & (1 << (group % 8))) != 0);
+	}
+
+	void markLevelDirty(uint16_t level)
+	{
+		const uint8_t group = static_cast<uint8_t>(level / levelsPerGroup);
+
+		this->dirtyGroups[group / 8] |= static_cast<uint8_t>(1 << (group % 8));
+	}
+
+	// Applies a record read from the journal.
+	void apply(const SaveRecord & record);
+};
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include "SaveJournal.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <EEPROM.h>
+
+#include "../Utils.h"
+
+void SaveJournal::begin()
+{
+	for(uint16_t keyIndex = 0; keyIndex < saveKeyCount; ++keyIndex)
+		this->currentSlots[keyIndex] = noSlot;
+
+	for(uint8_t index = 0; index < slotBytes; ++index)
+		this->currentSlotBits[index] = 0;
+
+	// The newest record is the one with the newest sequence number,
+	// and the slot after it is the one that's been left alone the longest.
+	bool found = false;
+	uint16_t newestSequence = 0;
+	uint8_t newestSlot = 0;
+
+	for(uint8_t slot = 0; slot < slotCount; ++slot)
+	{
+		StoredRecord stored;
+
+		if(!this->readSlot(slot, stored))
+			continue;
+
+		if(!found || isNewer(stored.sequence, newestSequence))
+		{
+			found = true;
+			newestSequence = stored.sequence;
+			newestSlot = slot;
+		}
+
+		// A record about something that doesn't exist is never current,
+		// so its slot is free to be written over.
+		const uint16_t keyIndex = stored.record.getKeyIndex();
+
+		if(keyIndex >= saveKeyCount)
+			continue;
+
+		// If an earlier slot holds a newer record with the same key, this one's been replaced.
+		const uint8_t currentSlot = this->currentSlots[keyIndex];
+
+		if(currentSlot != noSlot)
+		{
+			StoredRecord current;
+
+			if(this->readSlot(currentSlot, current) && !isNewer(stored.sequence, current.sequence))
+				continue;
+		}
+
+		this->setCurrentSlot(keyIndex, slot);
+	}
+
+	// If the journal is empty, start from the beginning.
+	if(!found)
+	{
+		this->nextSlot = 0;
+		this->nextSequence = 0;
+		return;
+	}
+
+	this->nextSlot = (((newestSlot + 1) < slotCount) ? (newestSlot + 1) : 0);
+	this->nextSequence = (newestSequence + 1);
+}
+
+bool SaveJournal::readCurrentRecord(uint16_t keyIndex, SaveRecord & record) const
+{
+	const uint8_t slot = this->currentSlots[keyIndex];
+
+	StoredRecord stored;
+
+	if((slot == noSlot) || !this->readSlot(slot, stored))
+		return false;
+
+	record = stored.record;
+	return true;
+}
+
+void SaveJournal::append(const SaveRecord & record)
+{
+	const uint16_t keyIndex = record.getKeyIndex();
+
+	// Only 'SaveData' appends records, and it never makes one like this.
+	if(keyIndex >= saveKeyCount)
+		return;
+
+	uint16_t sequence = this->nextSequence;
+
+	// The new record must come after the record it replaces,
+	// whatever sequence number the journal has got up to.
+	// (Usually it already does, so this is only a precaution.)
+	const uint8_t currentSlot = this->currentSlots[keyIndex];
+
+	if(currentSlot != noSlot)
+	{
+		StoredRecord current;
+
+		if(this->readSlot(currentSlot, current) && !isNewer(sequence, current.sequence))
+			sequence = (current.sequence + 1);
+	}
+
+	// Find the first slot from where the last record was written
+	// that holds nothing worth keeping.
+	// Taking the slots in turn like this spreads the wear between them.
+	uint8_t slot = this->nextSlot;
+
+	for(uint8_t count = 0; count < slotCount; ++count)
+	{
+		if(!this->isCurrentSlot(slot))
+		{
+			this->writeSlot(slot, StoredRecord { record, sequence });
+			this->setCurrentSlot(keyIndex, slot);
+
+			this->nextSlot = (((slot + 1) < slotCount) ? (slot + 1) : 0);
+			this->nextSequence = (sequence + 1);
+			return;
+		}
+
+		slot = (((slot + 1) < slotCount) ? (slot + 1) : 0);
+	}
+
+	// Every slot holds a record that's still needed.
+	// That can't happen while there are more slots than keys,
+	// which the journal's size makes sure of, so the record is dropped.
+}
+
+uint16_t SaveJournal::calculateCrc(const uint8_t * bytes)
+{
+	uint16_t crc = crcSeed;
+
+	for(uint8_t index = 0; index < (recordSize - 2); ++index)
+		crc = Utils::updateCrc16(crc, bytes[index]);
+
+	return crc;
+}
+
+bool SaveJournal::readSlot(uint8_t slot, StoredRecord & stored) const
+{
+	const uint16_t address = getAddress(slot);
+
+	uint8_t bytes[recordSize];
+
+	for(uint8_t index = 0; index < recordSize; ++index)
+		bytes[index] = EEPROM.read(address + index);
+
+	const uint16_t crc = static_cast<uint16_t>(bytes[recordSize - 2] | (bytes[recordSize - 1] << 8));
+
+	if(crc != calculateCrc(bytes))
+		return false;
+
+	stored.record.type = static_cast<SaveRecordType>(bytes[0]);
+	stored.record.key = bytes[1];
+
+	for(uint8_t index = 0; index < saveRecordDataSize; ++index)
+		stored.record.data[index] = bytes[2 + index];
+
+	stored.sequence = static_cast<uint16_t>(bytes[recordSize - 4] | (bytes[recordSize - 3] << 8));
+
+	return true;
+}
+
+void SaveJournal::writeSlot(uint8_t slot, const StoredRecord & stored)
+{
+	uint8_t bytes[recordSize];
+
+	bytes[0] = static_cast<uint8_t>(stored.record.type);
+	bytes[1] = stored.record.key;
+
+	for(uint8_t index = 0; index < saveRecordDataSize; ++index)
+		bytes[2 + index] = stored.record.data[index];
+
+	bytes[recordSize - 4] = static_cast<uint8_t>(stored.sequence & 0xFF);
+	bytes[recordSize - 3] = static_cast<uint8_t>(stored.sequence >> 8);
+
+	const uint16_t crc = calculateCrc(bytes);
+
+	bytes[recordSize - 2] = static_cast<uint8_t>(crc & 0xFF);
+	bytes[recordSize - 1] = static_cast<uint8_t>(crc >> 8);
+
+	const uint16_t address = getAddress(slot);
+
+	// 'update' skips bytes that haven't changed,
+	// which saves both time and wear.
+	for(uint8_t index = 0; index < recordSize; ++index)
+		EEPROM.update(address + index, bytes[index]);
+}
+
+void SaveJournal::setCurrentSlot(uint16_t keyIndex, uint8_t slot)
+{
+	const uint8_t oldSlot = this->currentSlots[keyIndex];
+
+	if(oldSlot != noSlot)
+		this->currentSlotBits[oldSlot / 8] &= static_cast<uint8_t>(~(1 << (oldSlot % 8)));
+
+	this->currentSlots[keyIndex] = slot;
+	this->currentSlotBits[slot / 8] |= static_cast<uint8_t>(1 << (slot % 8));
+}
\ No newline at end of file
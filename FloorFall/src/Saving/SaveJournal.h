@@ -0,0 +1,155 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For EEPROM_STORAGE_SPACE_START
+#include <Arduboy2.h>
+
+#include "SaveRecord.h"
+
+// An append-only journal of save records, kept in EEPROM.
+//
+// Each EEPROM byte wears out after about 100,000 writes,
+// and writing one takes about 3.4ms,
+// so rather than keeping the progress at a fixed address and rewriting it,
+// each change is appended as a small record
+// and the records take turns using the slots of a ring.
+//
+// Each record carries a sequence number and a CRC,
+// so a record that was only half written when the power went
+// (or a slot that's never been written, or another game's data)
+// is simply ignored, and a newer record replaces an older one with the same key.
+//
+// A record is only ever written into a slot that holds nothing worth keeping:
+// either nothing valid, or a record that a newer one has replaced.
+// So long as there are more slots than keys,
+// there's always such a slot, and losing power during a write
+// can only ever lose the record being written.
+//
+// The ring has a slot for each key, plus 'spareSlotCount' more for the wear to be spread across,
+// so it grows with the level pack rather than limiting it.
+// Reading every slot takes a while, so it's only done once, by 'begin',
+// which notes in RAM which slot holds each key's current record.
+// After that, reading a record or appending one only reads the slots it needs.
+//
+// As bytes, a record is:
+//   The type (1 byte)
+//   The key (1 byte)
+//   The data ('saveRecordDataSize' bytes)
+//   The sequence number (2 bytes, low byte first)
+//   The CRC-16 of all of the above (2 bytes, low byte first)
+class SaveJournal
+{
+public:
+	static constexpr uint8_t recordSize = (2 + saveRecordDataSize + 4);
+
+	// Where the ring starts in EEPROM.
+	static constexpr uint16_t firstAddress = EEPROM_STORAGE_SPACE_START;
+
+	// The most records that fit in the Arduboy's EEPROM.
+	static constexpr uint16_t maximumSlotCount = ((1024 - firstAddress) / recordSize);
+
+	static_assert(saveKeyCount < maximumSlotCount, "The level pack has too many levels for its progress to fit in EEPROM");
+
+	// The slots beyond one per key.
+	// Each slot is only written about once every 'spareSlotCount' saves.
+	static constexpr uint8_t spareSlotCount = 24;
+
+	// The number of records the ring can hold.
+	static constexpr uint8_t slotCount = (((saveKeyCount + spareSlotCount) < maximumSlotCount) ? (saveKeyCount + spareSlotCount) : maximumSlotCount);
+
+	// Where the ring ends in EEPROM.
+	static constexpr uint16_t endAddress = (firstAddress + (recordSize * slotCount));
+
+private:
+	// The CRC starts from this rather than the usual seed,
+	// so that another game's data is even less likely to be mistaken for a record.
+	static constexpr uint16_t crcSeed = 0xF10F;
+
+	// A record as it's stored.
+	struct StoredRecord
+	{
+		SaveRecord record;
+		uint16_t sequence;
+	};
+
+	// Marks a key that has no record.
+	static constexpr uint8_t noSlot = 0xFF;
+
+	static constexpr uint8_t slotBytes = ((slotCount + 7) / 8);
+
+private:
+	// The slot holding each key's current record, or 'noSlot'.
+	uint8_t currentSlots[saveKeyCount];
+
+	// Which slots hold a key's current record, and so mustn't be written over.
+	// One bit per slot.
+	uint8_t currentSlotBits[slotBytes];
+
+	// Where to start looking for a free slot.
+	uint8_t nextSlot { 0 };
+
+	// The sequence number for the next record.
+	uint16_t nextSequence { 0 };
+
+public:
+	// Reads every slot, finding each key's current record
+	// and where the last record was written, so that appending carries on from there.
+	// Must be called before anything else.
+	void begin();
+
+	// Reads the current record for a key (see 'SaveRecord::getKeyIndex').
+	// Returns false if there isn't one.
+	bool readCurrentRecord(uint16_t keyIndex, SaveRecord & record) const;
+
+	// Appends a record, replacing any older record with the same key.
+	// Takes about 3.4ms for each byte that changes,
+	// so this should only be done when a dropped frame won't be noticed.
+	void append(const SaveRecord & record);
+
+private:
+	static uint16_t getAddress(uint8_t slot)
+	{
+		return (firstAddress + (slot * recordSize));
+	}
+
+	// Determines whether one sequence number came after another,
+	// allowing for the numbers wrapping around.
+	static bool isNewer(uint16_t sequence, uint16_t other)
+	{
+		return (static_cast<int16_t>(sequence - other) > 0);
+	}
+
+	static uint16_t calculateCrc(const uint8_t * bytes);
+
+	// Reads a slot.
+	// Returns false if it doesn't hold a valid record.
+	bool readSlot(uint8_t slot, StoredRecord & stored) const;
+
+	void writeSlot(uint8_t slot, const StoredRecord & stored);
+
+	bool isCurrentSlot(uint8_t slot) const
+	{
+		return ((this->currentSlotBits[slot / 8] & (1 << (slot % 8))) != 0);
+	}
+
+	// Makes a slot the current one for a key, in place of the key's old slot.
+	void setCurrentSlot(uint16_t keyIndex, uint8_t slot);
+};
\ No newline at end of file
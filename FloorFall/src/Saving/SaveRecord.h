@@ -0,0 +1,81 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+#include "../Levels.h"
+
+// What a save record holds.
+// A record's type and key together say what it's about,
+// so a newer record with the same type and key replaces an older one.
+enum class SaveRecordType : uint8_t
+{
+	// The key is the index of a group of 'saveRecordDataSize' levels,
+	// and each byte of the data is the fewest moves one of them has been completed in.
+	// Packing the levels like this means a pack needs a quarter as many keys,
+	// and so a quarter as many journal slots, as it has levels.
+	LevelResults = 1,
+
+	// The key is always zero,
+	// and the first two bytes of the data (low byte first)
+	// are the level last selected on the level select menu.
+	SelectedLevel = 2,
+
+	// The key is always zero,
+	// and the first byte of the data is the language picked on the title screen.
+	Language = 3,
+};
+
+// The number of bytes of data a record holds.
+constexpr uint8_t saveRecordDataSize = 4;
+
+// The number of groups the levels' results are saved in.
+constexpr uint16_t saveLevelGroupCount = ((Levels::levelCount + saveRecordDataSize - 1) / saveRecordDataSize);
+
+static_assert(saveLevelGroupCount <= 0x100, "A group of levels' key has to fit in a byte");
+
+// The number of different things a record can be about:
+// the selected level, the language, and each group of levels.
+constexpr uint16_t saveKeyCount = (2 + saveLevelGroupCount);
+
+// A single change to the saved progress.
+struct SaveRecord
+{
+	SaveRecordType type;
+	uint8_t key;
+	uint8_t data[saveRecordDataSize];
+
+	// Determines whether two records are about the same thing.
+	constexpr bool hasSameKey(const SaveRecord & other) const
+	{
+		return ((this->type == other.type) && (this->key == other.key));
+	}
+
+	// Returns a number below 'saveKeyCount' that's different for everything a record can be about,
+	// or 'saveKeyCount' if the record is about something that doesn't exist
+	// (and so was saved by a different version of the game).
+	constexpr uint16_t getKeyIndex() const
+	{
+		return
+			(this->type == SaveRecordType::SelectedLevel) ? ((this->key == 0) ? 0 : saveKeyCount) :
+			(this->type == SaveRecordType::Language) ? ((this->key == 0) ? 1 : saveKeyCount) :
+			(this->type == SaveRecordType::LevelResults) ? ((this->key < saveLevelGroupCount) ? (2 + this->key) : saveKeyCount) :
+			saveKeyCount;
+	}
+};
\ No newline at end of file
@@ -16,12 +16,40 @@
 //  limitations under the License.
 //
 
+// For uint8_t
+#include <stdint.h>
+
 #include "Language.h"
-#include "Strings.h"
 
 namespace Settings
 {
-	constexpr Language language = Language::EN_GB;
+	// The language the game starts in, until the player picks another on the title screen.
+	constexpr Language defaultLanguage = Language::EN_GB;
+
+	// If true, the screen is kept from one frame to the next
+	// and only the parts that have changed are redrawn.
+	// If false, the screen is cleared and redrawn every frame.
+	constexpr bool useDirtyRendering = true;
+
+	// If true, a frame in which nothing on screen has changed
+	// isn't rendered or sent to the display at all.
+	// (The display keeps showing what it was last sent.)
+	// If false, every frame is rendered and sent to the display.
+	constexpr bool useRenderOnChange = true;
+
+	// How many frames a direction has to be held before it repeats,
+	// and how many frames to wait between each repeat after that.
+	// (See 'Game::getRepeatingButtons' for where directions repeat.)
+	constexpr uint8_t inputRepeatDelay = 15;
+	constexpr uint8_t inputRepeatInterval = 5;
 
-	using Strings = LanguageStrings<Settings::language>;
+	// If true, every screen is drawn a page at a time
+	// and streamed straight to the display, and nothing uses the screen buffer,
+	// so its 1KB of RAM is left out of the build altogether.
+	// Define FLOORFALL_STREAMING_RENDERER to turn this on.
+	#if defined(FLOORFALL_STREAMING_RENDERER)
+	constexpr bool useStreamingRenderer = true;
+	#else
+	constexpr bool useStreamingRenderer = false;
+	#endif
 }
\ No newline at end of file
@@ -18,9 +18,25 @@
 
 #include "../Game.h"
 #include "../Images.h"
+#include "../Flash.h"
+#include "../Profiling.h"
 
 void GameplayState::update(Game & game)
 {
+	// Remember what was on screen before the update.
+	const auto oldPhase = this->phase;
+	const auto oldHintStatus = this->hintSolver.getStatus();
+	const auto oldReplayMode = this->replayMode;
+
+	// The animations play out in every phase,
+	// but they're only for show, so nothing waits for them.
+	game.getGameData().updateAnimations();
+
+	// Only the playing phase moves the player,
+	// so presses made during the other phases are dropped.
+	if(this->phase != GameplayPhase::Playing)
+		game.getInput().clear();
+
 	switch (this->phase)
 	{
 	case GameplayPhase::Playing:
@@ -35,6 +51,47 @@ void GameplayState::update(Game & game)
 		this->updateFailurePhase(game);
 		break;
 	}
+
+	// A replay ends when the level does.
+	if((this->replayMode != ReplayMode::Off) && (this->phase != GameplayPhase::Playing))
+		this->stopReplay(game);
+
+	// The phase messages, the hint and the replay message are drawn over the board and beside it,
+	// so if any of them change, it's simplest to redraw everything.
+	if((this->phase != oldPhase) || (this->hintSolver.getStatus() != oldHintStatus) || (this->replayMode != oldReplayMode))
+		game.requestRedraw();
+	// Otherwise, only the tiles that have changed need drawing,
+	// and if none have, the screen is just as it was.
+	else if(game.getGameData().hasDirtyTiles())
+		game.requestRender();
+}
+
+bool GameplayState::startReplay(Game & game, ReplayMode mode)
+{
+	// Get a mutable reference to the game data.
+	auto & gameData = game.getGameData();
+
+	// A replay with moves missing would go astray.
+	if(!gameData.getReplay().isComplete())
+		return false;
+
+	// Put the board back how it was when the replay was recorded.
+	if(!gameData.loadReplayLevel())
+		return false;
+
+	// Start from the first move.
+	this->phase = GameplayPhase::Playing;
+	this->replayMode = mode;
+	this->replayPosition = 0;
+	this->replayTimer = 0;
+
+	// Any hint is now out of date.
+	this->hintSolver.cancel();
+
+	// Fast-forwarding skips drawing the moves.
+	game.setFastForwarding(mode == ReplayMode::FastForward);
+
+	return true;
 }
 
 void GameplayState::render(Game & game)
@@ -57,8 +114,26 @@ void GameplayState::render(Game & game)
 
 void GameplayState::updatePlayingPhase(Game & game)
 {
-	// Update the player.
-	this->updatePlayer(game);
+	// If a replay is being played back...
+	if(this->replayMode != ReplayMode::Off)
+	{
+		// The replay is in control instead of the player,
+		// so any presses are dropped rather than saved for later.
+		game.getInput().clear();
+
+		this->updateReplay(game);
+	}
+	else
+	{
+		// Undo any moves the player wants to take back.
+		this->updateUndo(game);
+
+		// Update the player.
+		this->updatePlayer(game);
+
+		// Update the hint.
+		this->updateHint(game);
+	}
 
 	// Get a read-only reference to the shared game data.
 	const auto & gameData = game.getGameData();
@@ -68,6 +143,11 @@ void GameplayState::updatePlayingPhase(Game & game)
 	{
 		// Change the phase to success.
 		this->phase = GameplayPhase::Success;
+
+		// Note the result, unless it was a replay that completed the level.
+		// (It's saved when the player leaves the level.)
+		if(this->replayMode == ReplayMode::Off)
+			game.getGameData().getSaveData().recordCompletion(gameData.getLevelIndex(), gameData.getReplay().getTotalMoveCount());
 	}
 }
 
@@ -75,6 +155,19 @@ void GameplayState::renderPlayingPhase(Game & game) const
 {
 	// Render the board with the player on top.
 	this->renderBoardAndPlayer(game);
+
+	// Render the hint on top of that.
+	this->renderHint(game);
+
+	// Say when the moves are being made by a replay.
+	if(this->replayMode != ReplayMode::Off)
+	{
+		// Get a reference to the canvas.
+		auto & canvas = game.getCanvas();
+
+		canvas.setCursor(hintTextX, hintTextY);
+		canvas.drawText(game.getString(StringId::Replay));
+	}
 }
 
 void GameplayState::updateSuccessPhase(Game & game)
@@ -95,11 +188,15 @@ void GameplayState::updateSuccessPhase(Game & game)
 	// If the B button was pressed...
 	if(arduboy.justPressed(B_BUTTON))
 	{
-		// Reset the phase to playing.
-		this->phase = GameplayPhase::Playing;
+		// Watch the level being solved again.
+		// (If the replay is incomplete, return to the level select menu instead.)
+		if(!this->startReplay(game, ReplayMode::Watch))
+		{
+			// Reset the phase to playing.
+			this->phase = GameplayPhase::Playing;
 
-		// Return the player to the level select menu.
-		game.changeState(GameState::LevelSelectState);
+			game.changeState(GameState::LevelSelectState);
+		}
 	}
 }
 
@@ -108,12 +205,12 @@ void GameplayState::renderSuccessPhase(Game & game) const
 	// Render the board with the player on top.
 	this->renderBoardAndPlayer(game);
 
-	// Get a reference to the arduboy object.
-	auto & arduboy = game.getArduboy();
+	// Get a reference to the canvas.
+	auto & canvas = game.getCanvas();
 
 	// For now just print in the top left corner.
-	arduboy.setCursor(0, 0);
-	arduboy.println(F("SUCCESS"));
+	canvas.setCursor(0, 0);
+	canvas.drawText(F("SUCCESS"));
 }
 
 void GameplayState::updateFailurePhase(Game & game)
@@ -124,8 +221,13 @@ void GameplayState::updateFailurePhase(Game & game)
 	// If the A button was pressed...
 	if(arduboy.justPressed(A_BUTTON))
 	{
-		// Reset the level.
-		this->resetLevel(game);
+		// Take back the move that lost the level.
+		// (If it can't be undone, start the level again.)
+		if(!this->undoMove(game))
+			this->resetLevel(game);
+
+		// Holding the button from here on rewinds further.
+		this->rewindTimer = 0;
 
 		// Change the phase back to playing.
 		this->phase = GameplayPhase::Playing;
@@ -147,19 +249,62 @@ void GameplayState::renderFailurePhase(Game & game) const
 	// Render the board with the player on top.
 	this->renderBoardAndPlayer(game);
 
-	// Get a reference to the arduboy object.
-	auto & arduboy = game.getArduboy();
+	// Get a reference to the canvas.
+	auto & canvas = game.getCanvas();
 
 	// For now just print in the top left corner.
-	arduboy.setCursor(0, 0);
-	arduboy.println(F("FAILURE"));
+	canvas.setCursor(0, 0);
+	canvas.drawText(F("FAILURE"));
 }
 
 void GameplayState::updatePlayer(Game & game)
 {
-	// Get a mutable reference to the arduboy object.
-	auto & arduboy = game.getArduboy();
+	// Get a mutable reference to the input queue.
+	auto & input = game.getInput();
 
+	// Each press is its own move, so that every move is a single step
+	// that can be recorded and undone, but a few can be made in one frame
+	// so that quick presses aren't left waiting in the queue.
+	for(uint8_t moves = 0; (moves < movesPerUpdate) && !input.isEmpty(); ++moves)
+	{
+		switch(input.pop())
+		{
+			// If the player has pressed the left button...
+			case LEFT_BUTTON:
+				// Move the player left.
+				this->movePlayer(game, Direction::Left);
+				break;
+
+			// If the player has pressed the right button...
+			case RIGHT_BUTTON:
+				// Move the player right.
+				this->movePlayer(game, Direction::Right);
+				break;
+
+			// If the player has pressed the up button...
+			case UP_BUTTON:
+				// Move the player up.
+				this->movePlayer(game, Direction::Up);
+				break;
+
+			// If the player has pressed the down button...
+			case DOWN_BUTTON:
+				// Move the player down.
+				this->movePlayer(game, Direction::Down);
+				break;
+		}
+
+		// If that move ended the level, the remaining presses are meant for nothing.
+		if((this->phase != GameplayPhase::Playing) || this->areAllButtonsOn(game.getGameData().getBoard()))
+		{
+			input.clear();
+			break;
+		}
+	}
+}
+
+void GameplayState::movePlayer(Game & game, Direction direction)
+{
 	// Get a mutable reference to the game data.
 	auto & gameData = game.getGameData();
 
@@ -174,62 +319,242 @@ void GameplayState::updatePlayer(Game & game)
 	const auto oldPlayerX = playerX;
 	const auto oldPlayerY = playerY;
 
-	// If the player has pressed the left button...
-	if(arduboy.justPressed(LEFT_BUTTON))
+	// The board may be bigger than the map,
+	// so it's the edges of the map that stop the player.
+	switch(direction)
 	{
-		// If the player is not on the furthest left tile...
-		if(playerX > board.getLeftEdge())
-		{
-			// Move the player left.
-			--playerX;
-		}
+		case Direction::Left:
+			// If the player is not on the furthest left tile...
+			if(playerX > 0)
+				--playerX;
+			break;
+
+		case Direction::Right:
+			// If the player is not on the furthest right tile...
+			if((playerX + 1) < gameData.getMapWidth())
+				++playerX;
+			break;
+
+		case Direction::Up:
+			// If the player is not on the top tile...
+			if(playerY > 0)
+				--playerY;
+			break;
+
+		case Direction::Down:
+			// If the player is not on the bottom tile...
+			if((playerY + 1) < gameData.getMapHeight())
+				++playerY;
+			break;
 	}
 
-	// If the player has pressed the right button...
-	if(arduboy.justPressed(RIGHT_BUTTON))
+	// If the player hasn't moved, there's nothing else to do.
+	if((playerX == oldPlayerX) && (playerY == oldPlayerY))
+		return;
+
+	// Any hint is now out of date.
+	this->hintSolver.cancel();
+
+	// Note the tiles as they were, to see what the move changes.
+	const uint8_t oldParameter = board.getCell(oldPlayerX, oldPlayerY).getParameter();
+	const uint8_t newParameter = board.getCell(playerX, playerY).getParameter();
+
+	// Step off the old tile.
+	this->stepOff(board, oldPlayerX, oldPlayerY);
+
+	// Step onto the new tile.
+	this->stepOn(board, playerX, playerY);
+
+	// Remember the move, and what it changed, so that it can be undone.
+	const bool tookStep = (board.getCell(oldPlayerX, oldPlayerY).getParameter() != oldParameter);
+	const bool toggledButton = (board.getCell(playerX, playerY).getParameter() != newParameter);
+
+	gameData.getHistory().push(Move { direction, tookStep, toggledButton });
+
+	// Record the move, unless it came from the replay in the first place.
+	if(this->replayMode == ReplayMode::Off)
+		gameData.getReplay().record(direction);
+
+	// Those are the only two tiles that could have changed,
+	// and the player has left one and arrived on the other.
+	gameData.markTileDirty(oldPlayerX, oldPlayerY);
+	gameData.markTileDirty(playerX, playerY);
+
+	// Show what happened to them.
+	this->animateStepOff(gameData, oldPlayerX, oldPlayerY);
+	this->animateStepOn(gameData, playerX, playerY);
+
+	// If the player walked near the edge of the screen, scroll.
+	if(gameData.updateCamera())
+		game.requestRedraw();
+}
+
+void GameplayState::animateStepOff(GameData & gameData, uint8_t x, uint8_t y)
+{
+	const Tile tile = gameData.getBoard().getCell(x, y);
+
+	// Only broken tiles change when they're stepped off.
+	if(tile.getType() != TileType::Broken)
+		return;
+
+	// A tile with steps left crumbles a little,
+	// and a tile with none left falls away.
+	const auto type = (tile.getParameter() > 0) ? TileAnimationType::Crumble : TileAnimationType::Fall;
+
+	gameData.startAnimation(x, y, type);
+}
+
+void GameplayState::animateStepOn(GameData & gameData, uint8_t x, uint8_t y)
+{
+	const Tile tile = gameData.getBoard().getCell(x, y);
+
+	// Only buttons change when they're stepped on.
+	if(tile.getType() != TileType::Button)
+		return;
+
+	// The button has already been toggled.
+	const auto type = (tile.getParameter() != 0) ? TileAnimationType::Press : TileAnimationType::Release;
+
+	gameData.startAnimation(x, y, type);
+}
+
+void GameplayState::updateReplay(Game & game)
+{
+	// If the replay is being watched...
+	if(this->replayMode == ReplayMode::Watch)
 	{
-		// If the player is not on the furthest right tile...
-		if(playerX < board.getRightEdge())
+		// Get a reference to the arduboy object.
+		auto & arduboy = game.getArduboy();
+
+		// If the B button was pressed...
+		if(arduboy.justPressed(B_BUTTON))
 		{
-			// Move the player right
-			++playerX;
+			// Stop watching.
+			this->stopReplay(game);
+
+			// Return the player to the level select menu.
+			game.changeState(GameState::LevelSelectState);
+			return;
 		}
+
+		// Wait a while between moves, so they can be followed.
+		++this->replayTimer;
+
+		if(this->replayTimer < replayInterval)
+			return;
+
+		this->replayTimer = 0;
 	}
 
-	// If the player has pressed the up button...
-	if(arduboy.justPressed(UP_BUTTON))
+	// Get a read-only reference to the replay.
+	const auto & replay = game.getGameData().getReplay();
+
+	// If every move has been played, the player takes over from here.
+	if(this->replayPosition >= replay.getMoveCount())
 	{
-		// If the player is not on the top tile...
-		if(playerY > board.getTopEdge())
-		{
-			// Move the player up
-			--playerY;
-		}
+		this->stopReplay(game);
+		return;
 	}
 
-	// If the player has pressed the down button...
-	if(arduboy.justPressed(DOWN_BUTTON))
+	// Play the next move through the same path as the player's moves.
+	this->movePlayer(game, replay.getMove(this->replayPosition));
+	++this->replayPosition;
+}
+
+void GameplayState::stopReplay(Game & game)
+{
+	this->replayMode = ReplayMode::Off;
+
+	// Whatever happens next gets drawn.
+	game.setFastForwarding(false);
+}
+
+void GameplayState::updateUndo(Game & game)
+{
+	// Get a reference to the arduboy object.
+	auto & arduboy = game.getArduboy();
+
+	// If the A button was pressed...
+	if(arduboy.justPressed(A_BUTTON))
+	{
+		// Undo the last move.
+		this->undoMove(game);
+
+		// Start counting towards rewinding.
+		this->rewindTimer = 0;
+	}
+	// Otherwise, if the A button is being held...
+	else if(arduboy.pressed(A_BUTTON))
 	{
-		// If the player is not on the bottom tile...
-		if(playerY < board.getBottomEdge())
+		++this->rewindTimer;
+
+		// If it's been held for long enough...
+		if(this->rewindTimer >= rewindDelay)
 		{
-			// Move the player down.
-			++playerY;
+			// Undo another move.
+			this->undoMove(game);
+
+			// Wait a little before undoing the next one.
+			this->rewindTimer = (rewindDelay - rewindInterval);
 		}
 	}
+}
 
-	// Figure out if the player has moved.
-	const bool playerMoved = ((playerX != oldPlayerX) || (playerY != oldPlayerY));
+bool GameplayState::undoMove(Game & game)
+{
+	// Get a mutable reference to the game data.
+	auto & gameData = game.getGameData();
 
-	// If the player has moved...
-	if(playerMoved)
-	{
-		// Step off the old tile.
-		this->stepOff(board.getCell(oldPlayerX, oldPlayerY));
+	// Get a mutable reference to the move history.
+	auto & history = gameData.getHistory();
 
-		// Step onto the new tile.
-		this->stepOn(board.getCell(playerX, playerY));
-	}
+	// If there's nothing to undo, give up.
+	if(history.isEmpty())
+		return false;
+
+	const Move move = history.pop();
+
+	// The move is no longer part of the replay either.
+	gameData.getReplay().removeLast();
+
+	// Get a mutable reference to the game board.
+	auto & board = gameData.getBoard();
+
+	// Get a mutable reference to the player's position.
+	auto & playerX = gameData.getPlayerX();
+	auto & playerY = gameData.getPlayerY();
+
+	// Work out where the player was before the move.
+	const uint8_t oldPlayerX = static_cast<uint8_t>(playerX - getDeltaX(move.direction));
+	const uint8_t oldPlayerY = static_cast<uint8_t>(playerY - getDeltaY(move.direction));
+
+	// Reverse whatever the move changed, in the opposite order to 'movePlayer'.
+	if(move.toggledButton)
+		this->undoStepOn(board, playerX, playerY);
+
+	if(move.tookStep)
+		this->undoStepOff(board, oldPlayerX, oldPlayerY);
+
+	// Just as with a move, only those two tiles have changed.
+	gameData.markTileDirty(playerX, playerY);
+	gameData.markTileDirty(oldPlayerX, oldPlayerY);
+
+	// Whatever they were animating no longer matches them.
+	gameData.stopAnimation(playerX, playerY);
+	gameData.stopAnimation(oldPlayerX, oldPlayerY);
+
+	// Move the player back.
+	playerX = oldPlayerX;
+	playerY = oldPlayerY;
+
+	// Scroll back with them, if need be.
+	if(gameData.updateCamera())
+		game.requestRedraw();
+
+	// Any hint is now out of date.
+	this->hintSolver.cancel();
+
+	return true;
 }
 
 void GameplayState::renderPlayer(Game & game) const
@@ -237,14 +562,17 @@ void GameplayState::renderPlayer(Game & game) const
 	// Get a read-only reference to the game data.
 	const auto & gameData = game.getGameData();
 
-	// Calculate the y position of the player.
-	const uint8_t yOffset = (gameData.getPlayerY() * gameData.getTileHeight());
+	// Calculate the y position of the player on screen.
+	const int16_t yOffset = gameData.getScreenY(gameData.getPlayerY());
+
+	// Calculte the x position of the player on screen.
+	const int16_t xOffset = gameData.getScreenX(gameData.getPlayerX());
 
-	// Calculte the x position of the player.
-	const uint8_t xOffset = (gameData.getPlayerX() * gameData.getTileWidth());
+	// Get a reference to the canvas.
+	auto & canvas = game.getCanvas();
 
 	// Draw the player.
-	Sprites::drawSelfMasked(xOffset, yOffset, Images::player, 0);
+	canvas.drawSprite(xOffset, yOffset, Images::player, 0, DrawMode::SelfMasked);
 }
 
 void GameplayState::renderBoardAndPlayer(Game & game) const
@@ -256,13 +584,99 @@ void GameplayState::renderBoardAndPlayer(Game & game) const
 	// Get a mutable reference to the game data.
 	auto & gameData = game.getGameData();
 
+	// Get a reference to the canvas.
+	auto & canvas = game.getCanvas();
+
 	// Draw the game board first.
-	gameData.renderBoard();
+	// When streaming, every page starts out blank, so every tile needs drawing,
+	// and there's nothing left for the dirty tiles to say.
+	// (If they were left dirty, the next frame would be rendered for nothing.)
+	// Otherwise only the tiles that have changed need drawing.
+	if(game.isStreaming())
+	{
+		gameData.renderBoard(canvas);
+		gameData.clearDirtyTiles();
+	}
+	else
+	{
+		gameData.renderDirtyTiles(canvas);
+	}
+
+	// Then any tiles that are animating.
+	gameData.renderAnimations(canvas);
 
 	// Then draw the player on top of it.
 	this->renderPlayer(game);
 }
 
+void GameplayState::updateHint(Game & game)
+{
+	// Get a reference to the arduboy object.
+	auto & arduboy = game.getArduboy();
+
+	// If the B button was pressed...
+	if(arduboy.justPressed(B_BUTTON))
+	{
+		// If there isn't already a search underway...
+		if(this->hintSolver.getStatus() != HintStatus::Searching)
+		{
+			// Get a read-only reference to the shared game data.
+			const auto & gameData = game.getGameData();
+
+			// Start searching from the current position.
+			this->hintSolver.start(gameData.getBoard(), gameData.getMapWidth(), gameData.getMapHeight(), gameData.getPlayerX(), gameData.getPlayerY());
+		}
+	}
+
+	// Search for a little while.
+	// (This does nothing if there's no search underway.)
+	Profiler::enter(ProfileSection::HintSearch);
+	this->hintSolver.update();
+	Profiler::enter(ProfileSection::GameplayUpdate);
+}
+
+void GameplayState::renderHint(Game & game) const
+{
+	// Get a reference to the canvas.
+	auto & canvas = game.getCanvas();
+
+	// Get a read-only reference to the shared game data.
+	const auto & gameData = game.getGameData();
+
+	switch(this->hintSolver.getStatus())
+	{
+		case HintStatus::Idle:
+			break;
+
+		case HintStatus::Searching:
+			canvas.setCursor(hintTextX, hintTextY);
+			canvas.drawText(game.getString(StringId::Thinking));
+			break;
+
+		case HintStatus::Found:
+			{
+				// Draw an arrow over the tile the player should move to.
+				const auto direction = this->hintSolver.getHint();
+
+				const int16_t x = gameData.getScreenX(gameData.getPlayerX() + getDeltaX(direction));
+				const int16_t y = gameData.getScreenY(gameData.getPlayerY() + getDeltaY(direction));
+
+				canvas.drawSprite(x, y, Images::arrow, static_cast<uint8_t>(direction), DrawMode::Overwrite);
+			}
+			break;
+
+		case HintStatus::Lost:
+			canvas.setCursor(hintTextX, hintTextY);
+			canvas.drawText(game.getString(StringId::Lost));
+			break;
+
+		case HintStatus::GaveUp:
+			canvas.setCursor(hintTextX, hintTextY);
+			canvas.drawText(game.getString(StringId::NoHint));
+			break;
+	}
+}
+
 void GameplayState::stepOn(Tile & tile)
 {
 	// Cache the type and the parameter
@@ -335,42 +749,84 @@ void GameplayState::stepOff(Tile & tile)
 					// Decrease the number of remaining steps
 					tile.setParameter(parameter - 1);
 
-					// TODO:
-					// Consider implementing a falling animation when (parameter == 0)
+					// (The crumbling and falling animations are started by 'movePlayer',
+					// which knows where the tile is.)
 				}
 			}
 			break;
 	}
 }
 
-bool GameplayState::areAllButtonsOn(const Board & board)
+void GameplayState::undoStepOn(Board & board, uint8_t x, uint8_t y)
 {
-	// Create an alias for the board's size type.
-	using size_type = Board::size_type;
+	Tile tile = board.getCell(x, y);
 
-	// Strictly speaking, for the Arduboy Version
-	// I could get away with just using uint8_t.
-	// But if it doesn't cost much,
-	// there's no harm in a bit of future-proofing.
+	// The only change stepping onto a tile makes is toggling a button,
+	// so toggle it back.
+	tile.setParameter(tile.getParameter() ^ 1);
+	board.setCell(x, y, tile);
+}
 
-	for(size_type y = 0; y < board.getHeight(); ++y)
-		for(size_type x = 0; x < board.getWidth(); ++x)
-		{
-			// Get a read-only reference to the tile
-			const auto & tile = board.getCell(x, y);
-
-			// If the tile is a button
-			if(tile.getType() == TileType::Button)
-				// If the button is off
-				if(tile.getParameter() == 0)
-					// Return false because a button is off
-					return false;
-		}
+void GameplayState::undoStepOff(Board & board, uint8_t x, uint8_t y)
+{
+	Tile tile = board.getCell(x, y);
 
-	// If the end of the loop was reached
-	// (without encountering an off button)
-	// then assume all buttons are on.
-	return true;
+	// The only change stepping off of a tile makes is taking a step from a broken tile,
+	// so give the step back.
+	tile.setParameter(tile.getParameter() + 1);
+	board.setCell(x, y, tile);
+}
+
+void GameplayState::stepOn(TilePackedGrid & board, uint8_t x, uint8_t y)
+{
+	// The tiles are packed, so work on a copy and then put it back.
+	Tile tile = board.getCell(x, y);
+
+	// Defer to the tile version.
+	this->stepOn(tile);
+
+	board.setCell(x, y, tile);
+}
+
+void GameplayState::stepOff(TilePackedGrid & board, uint8_t x, uint8_t y)
+{
+	// The tiles are packed, so work on a copy and then put it back.
+	Tile tile = board.getCell(x, y);
+
+	// Defer to the tile version.
+	this->stepOff(tile);
+
+	board.setCell(x, y, tile);
+}
+
+void GameplayState::stepOn(TileBitBoard & board, uint8_t x, uint8_t y)
+{
+	// The bitboard implements the same rules as the tile version,
+	// it just needs to be told about failure.
+	if(!board.stepOn(x, y))
+	{
+		// Change the phase to failure.
+		this->phase = GameplayPhase::Failure;
+	}
+}
+
+void GameplayState::stepOff(TileBitBoard & board, uint8_t x, uint8_t y)
+{
+	// Decrease the number of remaining steps, if there are any.
+	board.stepOff(x, y);
+}
+
+bool GameplayState::areAllButtonsOn(const TileBitBoard & board)
+{
+	// No looping required, the bitboard can do this in one go.
+	return board.areAllButtonsOn();
+}
+
+bool GameplayState::areAllButtonsOn(const TilePackedGrid & board)
+{
+	// All buttons are on if there isn't a single off button.
+	// (The packed grid can search its bytes without unpacking every tile.)
+	return !board.contains(Tile::makeOffButton());
 }
 
 void GameplayState::resetLevel(Game & game)
@@ -380,4 +836,7 @@ void GameplayState::resetLevel(Game & game)
 
 	// Reload the last map.
 	gameData.reloadLastMap();
+
+	// Any hint is now out of date.
+	this->hintSolver.cancel();
 }
@@ -24,9 +24,11 @@
 #endif
 
 #include "../Logic.h"
+#include "../Logic/HintSolver.h"
 #include "../GameData.h"
 
 #include "GameplayPhase.h"
+#include "ReplayMode.h"
 
 class Game;
 
@@ -36,11 +38,51 @@ private:
 	// Create a private type alias to the game board.
 	using Board = GameData::Board;
 
+	// Create private type aliases for each kind of board.
+	using TilePackedGrid = GameData::TilePackedGrid;
+	using TileBitBoard = GameData::TileBitBoard;
+
+private:
+	// Drawing coordinates of the hint text.
+	// (To the right of an 8x8 map.)
+	static constexpr uint8_t hintTextX = 66;
+	static constexpr uint8_t hintTextY = 0;
+
+	// How many frames the A button has to be held before rewinding begins,
+	// and how many frames to wait between each move undone after that.
+	static constexpr uint8_t rewindDelay = 30;
+	static constexpr uint8_t rewindInterval = 6;
+
+	// How many frames to wait between moves when watching a replay.
+	static constexpr uint8_t replayInterval = 15;
+
+	// How many queued presses of the d-pad can be turned into moves in a single frame.
+	static constexpr uint8_t movesPerUpdate = 2;
+
 private:
 	// The phase/state of the game.
 	GameplayPhase phase { GameplayPhase::Playing };
 
+	// Looks for hints when asked to.
+	HintSolver hintSolver {};
+
+	// The number of frames the A button has been held for.
+	uint8_t rewindTimer { 0 };
+
+	// How the replay is being played back, if at all.
+	ReplayMode replayMode { ReplayMode::Off };
+
+	// The next move of the replay to be played.
+	uint8_t replayPosition { 0 };
+
+	// The number of frames since the last move of the replay.
+	uint8_t replayTimer { 0 };
+
 public:
+	// Starts playing back the game data's replay from the start of its level.
+	// Returns false if it can't be played back on this build of the game.
+	bool startReplay(Game & game, ReplayMode mode);
+
 	// Updates the game logic.
 	void update(Game & game);
 
@@ -63,20 +105,72 @@ private:
 	// Handles player input.
 	void updatePlayer(Game & game);
 
+	// Moves the player one tile, if the edge of the map isn't in the way,
+	// and records the move unless a replay is being played back.
+	void movePlayer(Game & game, Direction direction);
+
+	// Starts the animation for a tile that the player has just left.
+	void animateStepOff(GameData & gameData, uint8_t x, uint8_t y);
+
+	// Starts the animation for a tile that the player has just arrived on.
+	void animateStepOn(GameData & gameData, uint8_t x, uint8_t y);
+
+	// Plays back the next move of the replay, when it's time to.
+	void updateReplay(Game & game);
+
+	// Hands control back to the player.
+	void stopReplay(Game & game);
+
+	// Handles undoing and rewinding.
+	void updateUndo(Game & game);
+
+	// Takes back the last move.
+	// Returns false if there was nothing to undo.
+	bool undoMove(Game & game);
+
 	// Render's the player's character.
 	void renderPlayer(Game & game) const;
 
 	// Draws the board and the player.
 	void renderBoardAndPlayer(Game & game) const;
 
+	// Handles hint requests and runs the hint solver.
+	void updateHint(Game & game);
+
+	// Draws the hint, or the state of the hint solver.
+	void renderHint(Game & game) const;
+
 	// Handles stepping onto a tile.
 	void stepOn(Tile & tile);
 
 	// Handles stepping off of a tile.
 	void stepOff(Tile & tile);
 
+	// Handles stepping onto a cell of a packed grid.
+	void stepOn(TilePackedGrid & board, uint8_t x, uint8_t y);
+
+	// Handles stepping off of a cell of a packed grid.
+	void stepOff(TilePackedGrid & board, uint8_t x, uint8_t y);
+
+	// Handles stepping onto a cell of a bitboard.
+	void stepOn(TileBitBoard & board, uint8_t x, uint8_t y);
+
+	// Handles stepping off of a cell of a bitboard.
+	void stepOff(TileBitBoard & board, uint8_t x, uint8_t y);
+
+	// Reverses the effects of stepping onto a cell,
+	// which must have been changed by it.
+	void undoStepOn(Board & board, uint8_t x, uint8_t y);
+
+	// Reverses the effects of stepping off of a cell,
+	// which must have been changed by it.
+	void undoStepOff(Board & board, uint8_t x, uint8_t y);
+
+	// Determines if all buttons are on.
+	bool areAllButtonsOn(const TilePackedGrid & board);
+
 	// Determines if all buttons are on.
-	bool areAllButtonsOn(const Board & board);
+	bool areAllButtonsOn(const TileBitBoard & board);
 
 	// Resets the level.
 	void resetLevel(Game & game);
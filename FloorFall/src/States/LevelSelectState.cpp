@@ -17,7 +17,6 @@
 //
 
 #include "../Game.h"
-#include "../Settings.h"
 #include "../Flash.h"
 
 void LevelSelectState::update(Game & game)
@@ -25,40 +24,56 @@ void LevelSelectState::update(Game & game)
 	// Get a reference to the arduboy object.
 	auto & arduboy = game.getArduboy();
 
-	// If the up button was pressed...
-	if(arduboy.justPressed(UP_BUTTON))
-	{
-		// If the selected index is greater than the first index...
-		if(this->selectedIndex > firstIndex)
-		{
-			// Decrement the selected index.
-			--this->selectedIndex;
-
-			// The selected level has changed,
-			// so load the selected level.
-			this->loadSelectedLevel(game);
-		}
-	}
+	// Get a reference to the input queue.
+	auto & input = game.getInput();
 
-	// If the down button was pressed...
-	if(arduboy.justPressed(DOWN_BUTTON))
+	// Handle every press of the d-pad, including repeats from holding it.
+	// (Moving the cursor is cheap, so there's no need to limit it.)
+	while(!input.isEmpty())
 	{
-		// If the selected index is less than the last index...
-		if(this->selectedIndex < lastIndex)
+		switch(input.pop())
 		{
-			// Increment the selected index.
-			++this->selectedIndex;
-
-			// The selected level has changed,
-			// so load the selected level.
-			this->loadSelectedLevel(game);
+			// If the up button was pressed...
+			case UP_BUTTON:
+				// If the selected index is greater than the first index...
+				if(this->selectedIndex > firstIndex)
+				{
+					// Decrement the selected index.
+					--this->selectedIndex;
+
+					// The cursor has moved, and the list may have scrolled.
+					game.requestRedraw();
+				}
+				break;
+
+			// If the down button was pressed...
+			case DOWN_BUTTON:
+				// If the selected index is less than the last index...
+				if(this->selectedIndex < lastIndex)
+				{
+					// Increment the selected index.
+					++this->selectedIndex;
+
+					// The cursor has moved, and the list may have scrolled.
+					game.requestRedraw();
+				}
+				break;
 		}
 	}
 
+	// Remember the selection for next time.
+	// (It's only saved when leaving the menu.)
+	game.getGameData().getSaveData().setSelectedIndex(this->selectedIndex);
+
 	// If the A button was pressed...
 	if(arduboy.justPressed(A_BUTTON))
+	{
+		// Load the selected level.
+		this->loadSelectedLevel(game);
+
 		// Begin playing the selected level.
 		game.changeState(GameState::GameplayState);
+	}
 
 	// If the B button was pressed...
 	if(arduboy.justPressed(B_BUTTON))
@@ -68,62 +83,98 @@ void LevelSelectState::update(Game & game)
 
 void LevelSelectState::render(Game & game)
 {
-	this->renderLevelList(game);
-	this->renderSelectedLevel(game);
+	// The menu only changes when the selection does,
+	// and that asks for the whole screen to be redrawn.
+	if(!game.isRedrawing())
+		return;
+
+	const uint16_t firstVisibleIndex = this->getFirstVisibleIndex();
+
+	for(uint8_t offset = 0; offset < visibleCount; ++offset)
+	{
+		const uint16_t index = (firstVisibleIndex + offset);
+
+		// If there are fewer levels than entries, stop early.
+		if(index > lastIndex)
+			break;
+
+		this->renderEntry(game, index, (offset * entryHeight));
+	}
 }
 
 void LevelSelectState::loadSelectedLevel(Game & game)
 {
-	// Read a pointer from the level list.
-	const auto pointer = pgm_read_ptr(&Levels::levels[this->selectedIndex]);
-
-	// Convert it to a valid map pointer.
-	const auto map = static_cast<const uint8_t *>(pointer);
-
 	// Get a mutable reference to the game data.
 	auto & gameData = game.getGameData();
 
-	// Load the map.
-	gameData.loadMap(map);
+	// Load the level.
+	gameData.loadLevel(this->selectedIndex);
 }
 
-void LevelSelectState::renderLevelList(Game & game)
+uint16_t LevelSelectState::getFirstVisibleIndex() const
 {
-	// Get a reference to the arduboy object.
-	auto & arduboy = game.getArduboy();
+	// If every level fits on the screen, there's no need to scroll.
+	if(optionCount <= visibleCount)
+		return firstIndex;
 
-	// Rudimentary menu rendering.
-	// Renders three levels before and three levels after the selected level.
-	for(int16_t offset = -3; offset <= 3; ++offset)
-	{
-		const int16_t index = (this->selectedIndex + offset);
+	// Keep one level above the selected level in view...
+	const uint16_t index = (this->selectedIndex > firstIndex) ? (this->selectedIndex - 1) : firstIndex;
 
-		// If the calculated index is a valid level index.
-		if((index >= firstIndex) && (index <= lastIndex))
-		{
-			// If the offset is zero...
-			// (I.e. if this option is the selected level.)
-			if(offset == 0)
-				// Use an arrow to indicate the selected level.
-				arduboy.print(F("\x10 "));
-
-			// Create a temporary type alias.
-			using Strings = Settings::Strings;
-
-			// Print the level number.
-			arduboy.print(FlashString(Strings::level));
-			arduboy.print(index);
-		}
+	// ...unless that would leave part of the screen empty.
+	constexpr uint16_t lastFirstIndex = (optionCount - visibleCount);
 
-		arduboy.println();
-	}
+	return (index < lastFirstIndex) ? index : lastFirstIndex;
 }
 
-void LevelSelectState::renderSelectedLevel(Game & game)
+void LevelSelectState::renderEntry(Game & game, uint16_t index, int16_t y)
 {
-	// Get a mutable reference to the game data.
-	auto & gameData = game.getGameData();
+	// Get a reference to the canvas.
+	auto & canvas = game.getCanvas();
+
+	// If none of the entry would be visible, skip it.
+	if(!canvas.coversRows(y, entryHeight))
+		return;
+
+	// If this entry is the selected level...
+	if(index == this->selectedIndex)
+	{
+		// Use an arrow to indicate the selected level.
+		canvas.setCursor(cursorX, y);
+		canvas.drawText(F("\x10"));
+	}
+
+	// Draw the thumbnail, a page at a time.
+	const uint8_t * thumbnail = Levels::levels.getThumbnail(index);
+
+	for(uint8_t page = 0; page < LevelThumbnail::pageCount; ++page)
+		canvas.drawFrame(thumbnailX, (y + (page * Canvas::pageHeight)), &thumbnail[page * LevelThumbnail::width], LevelThumbnail::width, DrawMode::Overwrite);
+
+	// Print the level number.
+	canvas.setCursor(textX, y);
+	canvas.drawText(game.getString(StringId::Level));
+	canvas.drawNumber(index);
+
+	// Get a read-only reference to the player's progress.
+	const auto & saveData = game.getGameData().getSaveData();
+
+	// If the level has been completed, print the best move count beside it.
+	if(saveData.isCompleted(index))
+	{
+		canvas.drawText(game.getString(StringId::Best));
+		canvas.drawNumber(saveData.getBestMoves(index));
+	}
+
+	// Print the size of the map and its par underneath.
+	const LevelInfo info = Levels::levels.getLevelInfo(index);
+
+	canvas.setCursor(textX, (y + Canvas::pageHeight));
+	canvas.drawNumber(info.width);
+	canvas.drawCharacter('x');
+	canvas.drawNumber(info.height);
+	canvas.drawText(game.getString(StringId::Par));
 
-	// Render a preview of the board.
-	gameData.renderBoard(boardPreviewX, boardPreviewY);
+	if(info.par != LevelInfo::noPar)
+		canvas.drawNumber(info.par);
+	else
+		canvas.drawCharacter('?');
 }
\ No newline at end of file
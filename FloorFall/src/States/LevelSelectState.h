@@ -16,8 +16,10 @@
 //  limitations under the License.
 //
 
+// For HEIGHT
+#include <Arduboy2.h>
+
 #include "../Levels.h"
-#include "../Utils.h"
 
 class Game;
 
@@ -25,29 +27,49 @@ class LevelSelectState
 {
 private:
 	// The total number of options (levels).
-	static constexpr uint8_t optionCount = Utils::getSize(Levels::levels);
+	static constexpr uint16_t optionCount = Levels::levelCount;
 
 	// The first index of all options.
-	static constexpr uint8_t firstIndex = 0;
+	static constexpr uint16_t firstIndex = 0;
 
 	// The last index of all options.
-	static constexpr uint8_t lastIndex = (optionCount - 1);
+	static constexpr uint16_t lastIndex = (optionCount - 1);
+
+	static_assert(optionCount > 0, "There must be at least one level");
+
+	// Each entry in the list is as tall as a thumbnail,
+	// with room for two lines of text beside it.
+	static constexpr uint8_t entryHeight = LevelThumbnail::height;
 
-	// Drawing coordinates of the board preview.
-	static constexpr uint8_t boardPreviewX = 64;
-	static constexpr uint8_t boardPreviewY = 0;
+	// The number of entries that fit on the screen.
+	static constexpr uint8_t visibleCount = (HEIGHT / entryHeight);
+
+	// Drawing coordinates within each entry.
+	static constexpr uint8_t cursorX = 0;
+	static constexpr uint8_t thumbnailX = 8;
+	static constexpr uint8_t textX = (thumbnailX + LevelThumbnail::width + 4);
 
 private:
 	// The index of the selected level.
-	uint8_t selectedIndex;
+	uint16_t selectedIndex;
 
 public:
+	// Selects a level without any checks.
+	// The index must be that of a level.
+	void setSelectedIndex(uint16_t index)
+	{
+		this->selectedIndex = index;
+	}
+
 	void update(Game & game);
 	void render(Game & game);
 
 private:
 	void loadSelectedLevel(Game & game);
 
-	void renderLevelList(Game & game);
-	void renderSelectedLevel(Game & game);
+	// Gets the first level shown,
+	// keeping the selected level on screen.
+	uint16_t getFirstVisibleIndex() const;
+
+	void renderEntry(Game & game, uint16_t index, int16_t y);
 };
\ No newline at end of file
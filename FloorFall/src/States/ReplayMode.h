@@ -16,23 +16,18 @@
 //  limitations under the License.
 //
 
+// For uint8_t
 #include <stdint.h>
-#include <avr/pgmspace.h>
 
-#include "../Logic/Tile.h"
-
-namespace Levels
+// How a replay is being played back, if at all.
+enum class ReplayMode : uint8_t
 {
-	constexpr uint8_t level0[] PROGMEM
-	{
-		// Width, Height
-		5, 1,
+	// The player is in control.
+	Off,
 
-		// Player X, Player Y
-		0, 0,
+	// One move every so often, for watching.
+	Watch,
 
-		toTileByte(Tile::makeSolidTile(), Tile::makeSolidTile()),
-		toTileByte(Tile::makeOffButton(), Tile::makeSolidTile()),
-		toTileByte(Tile::makeOffButton(), Tile::makeEmptyTile()),
-	};
-}
\ No newline at end of file
+	// One move per update, without drawing anything in between.
+	FastForward,
+};
\ No newline at end of file
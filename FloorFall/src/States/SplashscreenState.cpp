@@ -32,6 +32,9 @@ void SplashscreenState::update(Game & game)
 		return;
 	}
 
+	// Remember how far the eye was open, to tell whether it's moved.
+	const auto oldBlinkTick = this->blinkTick;
+
 	// TODO: fix this god-awful mess.
 
 	// If blink delay is greater than zero...
@@ -72,6 +75,10 @@ void SplashscreenState::update(Game & game)
 				this->blinkInvert = !this->blinkInvert;
 		}
 	}
+
+	// The logo only needs drawing again if the eye has moved.
+	if (this->blinkTick != oldBlinkTick)
+		game.requestRender();
 }
 
 void SplashscreenState::render(Game & game)
@@ -79,7 +86,8 @@ void SplashscreenState::render(Game & game)
 	constexpr uint8_t logoX = ((Arduboy2::width() - Images::pharapLogoWidth) / 2);
 	constexpr uint8_t logoY = ((Arduboy2::height() - Images::pharapLogoHeight) / 2);
 
-	Sprites::drawOverwrite(logoX, logoY, Images::pharapLogo, 0);
+	// The logo is compressed, and unpacks straight onto the screen.
+	game.getCanvas().drawCompressedImage(logoX, logoY, Images::pharapLogo);
 	
 	constexpr uint8_t topEyelidLeft = (logoX + 14);
 	constexpr uint8_t topEyelidTop = (logoY + 15);
@@ -89,9 +97,9 @@ void SplashscreenState::render(Game & game)
 	
 	constexpr uint8_t eyelidWidth = (34 - 14);
 
-	// Get a reference to the arduboy object.
-	auto & arduboy = game.getArduboy();
+	// Get a reference to the canvas.
+	auto & canvas = game.getCanvas();
 
-	arduboy.fillRect(topEyelidLeft, topEyelidTop, eyelidWidth, this->blinkTick);
-	arduboy.fillRect(bottomEyelidLeft, bottomEyelidBottom - this->blinkTick, eyelidWidth, this->blinkTick);
+	canvas.fillRect(topEyelidLeft, topEyelidTop, eyelidWidth, this->blinkTick);
+	canvas.fillRect(bottomEyelidLeft, bottomEyelidBottom - this->blinkTick, eyelidWidth, this->blinkTick);
 }
\ No newline at end of file
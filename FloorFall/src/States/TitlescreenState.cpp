@@ -18,7 +18,6 @@
 
 #include "../Game.h"
 #include "../Images.h"
-#include "../Settings.h"
 #include "../Flash.h"
 
 void TitlescreenState::update(Game & game)
@@ -26,6 +25,25 @@ void TitlescreenState::update(Game & game)
 	// Get a reference to the arduboy object.
 	auto & arduboy = game.getArduboy();
 
+	// Get a reference to the player's progress, which remembers the language.
+	auto & saveData = game.getGameData().getSaveData();
+
+	const uint8_t language = static_cast<uint8_t>(saveData.getLanguage());
+
+	// Left and right pick the language, wrapping around at either end.
+	// (It's saved when the level select menu is entered.)
+	if(arduboy.justPressed(LEFT_BUTTON))
+	{
+		saveData.setLanguage(static_cast<Language>((language > 0) ? (language - 1) : (languageCount - 1)));
+		game.requestRedraw();
+	}
+
+	if(arduboy.justPressed(RIGHT_BUTTON))
+	{
+		saveData.setLanguage(static_cast<Language>(((language + 1) < languageCount) ? (language + 1) : 0));
+		game.requestRedraw();
+	}
+
 	// If the A button was pressed...
 	if(arduboy.justPressed(A_BUTTON))
 		// Go to the level select menu.
@@ -34,22 +52,38 @@ void TitlescreenState::update(Game & game)
 
 void TitlescreenState::render(Game & game)
 {
+	// Nothing here changes unless the language does,
+	// which asks for the whole screen to be redrawn.
+	if(!game.isRedrawing())
+		return;
+
 	// Calculate the position of the titlescreen banner. (At compile time.)
 	constexpr uint8_t titlescreenX = ((Arduboy2::width() - Images::titlescreenWidth) / 2);
 	constexpr uint8_t titleScreenY = 0;
 
 	// Draw the titlescreen banner.
-	Sprites::drawOverwrite(titlescreenX, titleScreenY, Images::titlescreen, 0);
+	// (It's compressed, and unpacks straight onto the screen.)
+	game.getCanvas().drawCompressedImage(titlescreenX, titleScreenY, Images::titlescreen);
 
-	// Get a reference to the arduboy object.
-	auto & arduboy = game.getArduboy();
+	// Get a reference to the canvas.
+	auto & canvas = game.getCanvas();
 
 	// Use arbitrary values for now.
-	arduboy.setCursor(48, 48);
-
-	// Create a temporary type alias.
-	using Strings = Settings::Strings;
+	canvas.setCursor(48, 48);
 
 	// Print a 'press A' style message.
-	arduboy.println(FlashString(Strings::pressA));
+	canvas.drawText(game.getString(StringId::PressA));
+
+	// Print the name of the language underneath, centred,
+	// with arrows either side to show that it can be changed.
+	const auto languageName = game.getString(StringId::LanguageName);
+
+	// The arrows and the spaces beside them take up four characters,
+	// and the gap after the last character doesn't count.
+	const uint8_t languageWidth = (((languageName.size() + 4) * Images::fontCellWidth) - (Images::fontCellWidth - Images::fontGlyphWidth));
+
+	canvas.setCursor(((Arduboy2::width() - languageWidth) / 2), 56);
+	canvas.drawText(F("< "));
+	canvas.drawText(languageName);
+	canvas.drawText(F(" >"));
 }
\ No newline at end of file
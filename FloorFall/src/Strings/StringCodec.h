@@ -0,0 +1,46 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t
+#include <stdint.h>
+
+// The format of the compressed strings that 'CompressedFlashString' prints,
+// shared with 'floorfall-stringc', which makes them.
+//
+// There's one dictionary of pairs, shared by every string of every language,
+// and each string is a series of codes:
+//   0x00 to 0x7F - a character.
+//   0x80 to 0xFF - the pair of codes at '(code - firstPairCode) * 2' in the dictionary.
+// A pair's codes may be pairs themselves, but no deeper than 'maximumDepth'.
+//
+// This is byte pair encoding: 'floorfall-stringc' repeatedly replaces
+// the most common pair of codes in all of the strings with a new code,
+// for as long as that saves space.
+// Strings aren't terminated; 'StringTable' keeps where each one starts and ends.
+namespace StringCodec
+{
+	// The first code that stands for a pair rather than a character.
+	constexpr uint8_t firstPairCode = 0x80;
+
+	// The most pairs a dictionary can hold.
+	constexpr uint8_t maximumPairCount = (0x100 - firstPairCode);
+
+	// How many pairs deep a code can go.
+	// (Printing a string recurses once per level.)
+	constexpr uint8_t maximumDepth = 8;
+}
\ No newline at end of file
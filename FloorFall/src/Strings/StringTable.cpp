@@ -1,4 +1,4 @@
-#include "EN-GB.h"
+#include "StringTable.h"
 
 //
 //  Copyright (C) 2021 Pharap (@Pharap)
@@ -16,6 +16,8 @@
 //  limitations under the License.
 //
 
+// Made by floorfall-stringc from EN-GB.txt and NL-NL.txt, don't edit this by hand.
+
 // Unfortunately it's necessary to 'define' these here
 // despite this not actually providing the compiler with
 // any information that it didn't have before.
@@ -25,5 +27,6 @@
 // C++17 fixed this annoying discrepency by introducing 'inline' variables.
 // But Arduino-land only supports C++11, not C++17.
 
-constexpr char LanguageStrings<Language::EN_GB>::pressA[];
-constexpr char LanguageStrings<Language::EN_GB>::level[];
\ No newline at end of file
+constexpr uint8_t StringTable::dictionary[];
+constexpr uint8_t StringTable::codes[];
+constexpr uint8_t StringTable::offsets[];
\ No newline at end of file
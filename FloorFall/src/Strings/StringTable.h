@@ -0,0 +1,139 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// Made by floorfall-stringc from EN-GB.txt and NL-NL.txt, don't edit this by hand.
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+// For PROGMEM
+#include <avr/pgmspace.h>
+
+#include "../Language.h"
+
+// The strings that every language has.
+enum class StringId : uint8_t
+{
+	LanguageName,
+	PressA,
+	Level,
+	Par,
+	Best,
+	Thinking,
+	Lost,
+	NoHint,
+	Replay,
+};
+
+constexpr uint8_t stringIdCount = 9;
+
+// Every language's strings, compressed as described by 'StringCodec'.
+struct StringTable
+{
+	// The pairs that the codes from 0x80 upwards stand for, shared by every language.
+	static constexpr uint8_t dictionary[] PROGMEM
+	{
+		// 0x80 "in"
+		0x69, 0x6E,
+		// 0x81 "en"
+		0x65, 0x6E,
+		// 0x82 "er"
+		0x65, 0x72,
+		// 0x83 "es"
+		0x65, 0x73,
+		// 0x84 "hin"
+		0x68, 0x80,
+	};
+
+	static constexpr uint8_t codes[] PROGMEM
+	{
+		// EN_GB LanguageName "English"
+		0x45, 0x6E, 0x67, 0x6C, 0x69, 0x73, 0x68,
+
+		// EN_GB PressA "Press A"
+		0x50, 0x72, 0x83, 0x73, 0x20, 0x41,
+
+		// EN_GB Level "Level "
+		0x4C, 0x65, 0x76, 0x65, 0x6C, 0x20,
+
+		// EN_GB Par " Par "
+		0x20, 0x50, 0x61, 0x72, 0x20,
+
+		// EN_GB Best " Best "
+		0x20, 0x42, 0x83, 0x74, 0x20,
+
+		// EN_GB Thinking "Thinking"
+		0x54, 0x84, 0x6B, 0x80, 0x67,
+
+		// EN_GB Lost "Lost"
+		0x4C, 0x6F, 0x73, 0x74,
+
+		// EN_GB NoHint "No hint"
+		0x4E, 0x6F, 0x20, 0x84, 0x74,
+
+		// EN_GB Replay "Replay"
+		0x52, 0x65, 0x70, 0x6C, 0x61, 0x79,
+
+		// NL_NL LanguageName "Nederlands"
+		0x4E, 0x65, 0x64, 0x82, 0x6C, 0x61, 0x6E, 0x64, 0x73,
+
+		// NL_NL PressA "Druk op A"
+		0x44, 0x72, 0x75, 0x6B, 0x20, 0x6F, 0x70, 0x20, 0x41,
+
+		// NL_NL Level "Level "
+		0x4C, 0x65, 0x76, 0x65, 0x6C, 0x20,
+
+		// NL_NL Par " Par "
+		0x20, 0x50, 0x61, 0x72, 0x20,
+
+		// NL_NL Best " Best "
+		0x20, 0x42, 0x83, 0x74, 0x20,
+
+		// NL_NL Thinking "Nadenken"
+		0x4E, 0x61, 0x64, 0x81, 0x6B, 0x81,
+
+		// NL_NL Lost "Verloren"
+		0x56, 0x82, 0x6C, 0x6F, 0x72, 0x81,
+
+		// NL_NL NoHint "Geen hint"
+		0x47, 0x65, 0x81, 0x20, 0x84, 0x74,
+
+		// NL_NL Replay "Herhaling"
+		0x48, 0x82, 0x68, 0x61, 0x6C, 0x80, 0x67,
+	};
+
+	// Where each string's codes start in 'codes', language by language,
+	// followed by where the last language's last string ends.
+	// (So a string's codes end where the next string's start.)
+	static constexpr uint8_t offsets[] PROGMEM
+	{
+		// EN_GB
+		0, 7, 13, 19, 24, 29, 34, 38, 43,
+
+		// NL_NL
+		49, 58, 67, 73, 78, 83, 89, 95, 101,
+
+		// The end
+		108,
+	};
+};
+
+// The table holds the languages in the same order as 'Language'.
+static_assert(languageCount == 2, "The string table doesn't have every language");
+static_assert(static_cast<uint8_t>(Language::EN_GB) == 0, "The string table's languages are in the wrong order");
+static_assert(static_cast<uint8_t>(Language::NL_NL) == 1, "The string table's languages are in the wrong order");
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "Strings.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For pgm_read_byte, pgm_read_word
+#include <avr/pgmspace.h>
+
+namespace
+{
+	// 'floorfall-stringc' only makes the offsets as big as they need to be.
+	inline uint16_t readOffset(const uint8_t * offset)
+	{
+		return pgm_read_byte(offset);
+	}
+
+	inline uint16_t readOffset(const uint16_t * offset)
+	{
+		return pgm_read_word(offset);
+	}
+}
+
+CompressedFlashString getString(Language language, StringId id)
+{
+	// Each language's strings follow on from the previous language's.
+	const uint16_t index = ((static_cast<uint8_t>(language) * stringIdCount) + static_cast<uint8_t>(id));
+
+	// A string's codes end where the next string's begin.
+	const uint16_t start = readOffset(&StringTable::offsets[index]);
+	const uint16_t end = readOffset(&StringTable::offsets[index + 1]);
+
+	return CompressedFlashString(&StringTable::codes[start], static_cast<uint8_t>(end - start), StringTable::dictionary);
+}
\ No newline at end of file
@@ -16,10 +16,15 @@
 //  limitations under the License.
 //
 
+
 #include "../Language.h"
+#include "../Flash/CompressedFlashString.h"
 
-// Predeclare template.
-template<Language language>
-struct LanguageStrings;
+#include "StringTable.h"
 
-#include "EN-GB.h"
\ No newline at end of file
+// Finds one of the strings in one of the languages.
+//
+// Every language's strings are packed into the one 'StringTable',
+// so this takes the same two reads of the table's offsets
+// whichever string and whichever language it is.
+CompressedFlashString getString(Language language, StringId id);
\ No newline at end of file
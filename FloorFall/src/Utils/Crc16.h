@@ -0,0 +1,40 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For uint8_t, uint16_t
+#include <stdint.h>
+
+namespace Utils
+{
+	// The starting value for 'updateCrc16'.
+	constexpr uint16_t crc16Seed = 0xFFFF;
+
+	// Adds a byte to a CRC-16/CCITT checksum.
+	// This works a bit at a time rather than using a table,
+	// because a table would cost 512 bytes of progmem to save a few cycles
+	// on something that only ever checks a handful of bytes.
+	inline uint16_t updateCrc16(uint16_t crc, uint8_t byte)
+	{
+		crc ^= static_cast<uint16_t>(byte << 8);
+
+		for(uint8_t bit = 0; bit < 8; ++bit)
+			crc = ((crc & 0x8000) != 0) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+
+		return crc;
+	}
+}
\ No newline at end of file
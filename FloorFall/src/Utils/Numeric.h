@@ -31,4 +31,12 @@ namespace Utils
 	{
 		return ((value % 2) != 0);
 	}
+
+	/// Returns the lesser of two values.
+	/// (Arduino's 'min' is a macro, which evaluates its arguments twice.)
+	template<typename Type>
+	constexpr Type minimum(Type left, Type right)
+	{
+		return (right < left) ? right : left;
+	}
 }
\ No newline at end of file
@@ -14,5 +14,6 @@
 //  limitations under the License.
 //
 
+#include "Crc16.h"
 #include "GetSize.h"
 #include "Numeric.h"
\ No newline at end of file
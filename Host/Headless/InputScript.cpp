@@ -0,0 +1,117 @@
+#include "InputScript.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <Arduboy2.h>
+
+namespace
+{
+	struct ButtonName
+	{
+		const char * name;
+		std::uint8_t button;
+	};
+
+	constexpr ButtonName buttonNames[]
+	{
+		{ "LEFT", LEFT_BUTTON },
+		{ "RIGHT", RIGHT_BUTTON },
+		{ "UP", UP_BUTTON },
+		{ "DOWN", DOWN_BUTTON },
+		{ "A", A_BUTTON },
+		{ "B", B_BUTTON },
+	};
+
+	// A script this long is almost certainly a mistake.
+	constexpr std::size_t maxFrames = (std::size_t(1) << 28);
+}
+
+InputScript InputScript::load(const std::string & path)
+{
+	std::ifstream file { path };
+
+	if(!file)
+		throw std::runtime_error("can't open " + path);
+
+	InputScript script;
+
+	std::string line;
+
+	for(std::size_t lineNumber = 1; std::getline(file, line); ++lineNumber)
+	{
+		const auto where = [&]()
+		{
+			return (path + ":" + std::to_string(lineNumber) + ": ");
+		};
+
+		// Strip any comment.
+		const auto comment = line.find('#');
+
+		if(comment != std::string::npos)
+			line.erase(comment);
+
+		std::istringstream stream { line };
+		std::string token;
+
+		// Skip blank lines.
+		if(!(stream >> token))
+			continue;
+
+		std::size_t count;
+
+		try
+		{
+			std::size_t used;
+			count = std::stoul(token, &used);
+
+			if(used != token.size())
+				throw std::invalid_argument(token);
+		}
+		catch(const std::logic_error &)
+		{
+			throw std::runtime_error(where() + "expected a frame count, not '" + token + "'");
+		}
+
+		std::uint8_t buttons = 0;
+
+		while(stream >> token)
+		{
+			bool found = false;
+
+			for(const auto & buttonName : buttonNames)
+				if(token == buttonName.name)
+				{
+					buttons |= buttonName.button;
+					found = true;
+				}
+
+			if(!found)
+				throw std::runtime_error(where() + "unknown button '" + token + "'");
+		}
+
+		if((script.frames.size() + count) > maxFrames)
+			throw std::runtime_error(where() + "the script is too long");
+
+		script.frames.insert(script.frames.end(), count, buttons);
+	}
+
+	return script;
+}
\ No newline at end of file
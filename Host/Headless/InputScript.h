@@ -0,0 +1,66 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// The buttons held down on each frame of a run.
+//
+// A script is a text file where each line holds a frame count
+// followed by the names of the buttons held down for that many frames
+// ('LEFT', 'RIGHT', 'UP', 'DOWN', 'A' and 'B'), separated by whitespace.
+// A line with no buttons holds nothing down.
+// Everything after a '#' is a comment.
+//
+// 'justPressed' only fires on the frame a button goes down,
+// so pressing the same button twice needs a gap in between:
+//
+//     # Walk two tiles right.
+//     1 RIGHT
+//     1
+//     1 RIGHT
+class InputScript
+{
+private:
+	std::vector<std::uint8_t> frames;
+
+public:
+	// Reads a script from a file.
+	// Throws 'std::runtime_error' if the file can't be read or doesn't make sense.
+	static InputScript load(const std::string & path);
+
+	// The number of frames the script covers.
+	std::size_t getFrameCount() const
+	{
+		return this->frames.size();
+	}
+
+	bool isEmpty() const
+	{
+		return this->frames.empty();
+	}
+
+	// Returns the buttons held down on a frame,
+	// or no buttons if the frame is past the end of the script.
+	std::uint8_t getButtons(std::size_t frame) const
+	{
+		return (frame < this->frames.size()) ? this->frames[frame] : 0;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,351 @@
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// floorfall-headless
+//
+// Usage:
+//   floorfall-headless [--frames N] [--script FILE [--loop]] [--replay FILE [--fast]] [--record FILE] [--eeprom FILE] [--pbm FILE] [--expect-idle N]
+//
+// Runs the game for N frames (by default the length of the script,
+// or 3600 frames if there is no script) as fast as the CPU allows,
+// feeding it the buttons from the script (see 'InputScript.h').
+// With '--loop', the script starts over whenever it runs out.
+//
+// With '--replay', the game goes straight to playing back a replay
+// (see 'Logic/Replay.h'), and with '--fast' it fast-forwards through it,
+// one move per frame without drawing anything.
+// With '--record', the replay of the last level played is saved afterwards.
+//
+// With '--eeprom', the EEPROM is loaded from FILE beforehand (if it exists)
+// and saved back to it afterwards, so that progress carries over between runs.
+//
+// Afterwards it reports the frame rate achieved and a hash of the screen,
+// and with '--pbm' it saves the final screen as a portable bitmap.
+//
+// With '--expect-idle', it also counts the frames that sent anything to the display,
+// and fails if any of the last N frames did.
+// Nothing changes on a screen that's been left alone,
+// so after the first frame of it, nothing should be drawn or sent.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Game.h"
+
+#include "InputScript.h"
+
+namespace
+{
+	// Just like 'FloorFall.ino'.
+	Game game;
+
+	constexpr std::size_t defaultFrameCount = 3600;
+
+	// An Arduboy runs 'loop' about once a millisecond while it waits for the next frame,
+	// and the game samples the buttons every time, so each frame is preceded by this many loops.
+	constexpr std::size_t idleLoopsPerFrame = 15;
+
+	[[noreturn]] void usage()
+	{
+		std::fprintf(stderr, "usage: floorfall-headless [--frames N] [--script FILE [--loop]] [--replay FILE [--fast]] [--record FILE] [--eeprom FILE] [--pbm FILE] [--expect-idle N]\n");
+		std::exit(2);
+	}
+
+	// FNV-1a, so that runs can be compared at a glance.
+	// (This hashes what's on the display, not the screen buffer,
+	// so that streamed screens count too.)
+	std::uint64_t hashScreen()
+	{
+		const std::uint8_t * buffer = Arduboy2Core::getHostDisplay();
+
+		std::uint64_t hash = 0xCBF29CE484222325ULL;
+
+		for(std::size_t index = 0; index < ((WIDTH * HEIGHT) / 8); ++index)
+		{
+			hash ^= buffer[index];
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+
+	std::vector<std::uint8_t> loadFile(const std::string & path)
+	{
+		std::ifstream file { path, std::ios::binary };
+
+		if(!file)
+			throw std::runtime_error("can't open " + path);
+
+		return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	void saveReplay(const std::string & path)
+	{
+		std::ofstream file { path, std::ios::binary };
+
+		if(!file)
+			throw std::runtime_error("can't create " + path);
+
+		const Replay & replay = game.getGameData().getReplay();
+
+		for(std::uint8_t index = 0; index < replay.getSize(); ++index)
+			file.put(static_cast<char>(replay.getByte(index)));
+
+		if(!file)
+			throw std::runtime_error("can't write " + path);
+	}
+
+	// Fills the EEPROM from a file, if there is one.
+	void loadEeprom(const std::string & path)
+	{
+		std::ifstream file { path, std::ios::binary };
+
+		if(!file)
+			return;
+
+		file.read(reinterpret_cast<char *>(EEPROMClass::getHostData()), EEPROMClass::size);
+
+		if(file.gcount() != EEPROMClass::size)
+			throw std::runtime_error(path + " isn't the size of the EEPROM");
+	}
+
+	void saveEeprom(const std::string & path)
+	{
+		std::ofstream file { path, std::ios::binary };
+
+		if(!file)
+			throw std::runtime_error("can't create " + path);
+
+		file.write(reinterpret_cast<const char *>(EEPROMClass::getHostData()), EEPROMClass::size);
+
+		if(!file)
+			throw std::runtime_error("can't write " + path);
+	}
+
+	// Saves the screen as a binary PBM, lit pixels white.
+	void saveScreen(const std::string & path)
+	{
+		std::ofstream file { path, std::ios::binary };
+
+		if(!file)
+			throw std::runtime_error("can't create " + path);
+
+		file << "P4\n" << WIDTH << ' ' << HEIGHT << '\n';
+
+		const std::uint8_t * display = Arduboy2Core::getHostDisplay();
+
+		for(std::uint8_t y = 0; y < HEIGHT; ++y)
+			for(std::uint8_t x = 0; x < WIDTH; x += 8)
+			{
+				// PBM rows are packed most significant bit first, and 1 is black.
+				std::uint8_t byte = 0;
+
+				for(std::uint8_t bit = 0; bit < 8; ++bit)
+					if(((display[((y / 8) * WIDTH) + x + bit] >> (y % 8)) & 1) == 0)
+						byte |= static_cast<std::uint8_t>(0x80 >> bit);
+
+				file.put(static_cast<char>(byte));
+			}
+
+		if(!file)
+			throw std::runtime_error("can't write " + path);
+	}
+}
+
+int main(int argumentCount, char * arguments[])
+{
+	std::size_t frameCount = 0;
+	bool frameCountGiven = false;
+	std::size_t idleFrameCount = 0;
+	bool idleFrameCountGiven = false;
+	bool loop = false;
+	bool fast = false;
+	std::string pbmPath;
+	std::string recordPath;
+	std::string eepromPath;
+	std::vector<std::uint8_t> replayBytes;
+	InputScript script;
+
+	try
+	{
+		for(int index = 1; index < argumentCount; ++index)
+		{
+			const std::string argument { arguments[index] };
+
+			if(argument == "--loop")
+			{
+				loop = true;
+			}
+			else if(argument == "--fast")
+			{
+				fast = true;
+			}
+			else if((argument == "--frames") || (argument == "--script") || (argument == "--replay") || (argument == "--record") || (argument == "--eeprom") || (argument == "--pbm") || (argument == "--expect-idle"))
+			{
+				if((index + 1) >= argumentCount)
+					usage();
+
+				const std::string value { arguments[++index] };
+
+				if(argument == "--frames")
+				{
+					frameCount = std::stoull(value);
+					frameCountGiven = true;
+				}
+				else if(argument == "--expect-idle")
+				{
+					idleFrameCount = std::stoull(value);
+					idleFrameCountGiven = true;
+				}
+				else if(argument == "--script")
+				{
+					script = InputScript::load(value);
+				}
+				else if(argument == "--replay")
+				{
+					replayBytes = loadFile(value);
+
+					if(replayBytes.empty())
+						throw std::runtime_error(value + " is empty");
+				}
+				else if(argument == "--record")
+				{
+					recordPath = value;
+				}
+				else if(argument == "--eeprom")
+				{
+					eepromPath = value;
+					loadEeprom(eepromPath);
+				}
+				else
+				{
+					pbmPath = value;
+				}
+			}
+			else
+			{
+				usage();
+			}
+		}
+	}
+	catch(const std::exception & exception)
+	{
+		std::fprintf(stderr, "floorfall-headless: %s\n", exception.what());
+		return 2;
+	}
+
+	if((loop && script.isEmpty()) || (fast && replayBytes.empty()))
+		usage();
+
+	if(!frameCountGiven)
+		frameCount = script.isEmpty() ? defaultFrameCount : script.getFrameCount();
+
+	if(idleFrameCount > frameCount)
+		usage();
+
+	const auto start = std::chrono::steady_clock::now();
+
+	game.setup();
+
+	if(!replayBytes.empty())
+	{
+		if(!game.getGameData().getReplay().load(replayBytes.data(), replayBytes.size()))
+		{
+			std::fprintf(stderr, "floorfall-headless: that isn't a replay\n");
+			return 2;
+		}
+
+		if(!game.startReplay(fast ? ReplayMode::FastForward : ReplayMode::Watch))
+		{
+			std::fprintf(stderr, "floorfall-headless: the replay doesn't match this build's levels\n");
+			return 1;
+		}
+	}
+
+	// The frames that sent something to the display while they should have been idle.
+	std::size_t busyFrameCount = 0;
+
+	for(std::size_t frame = 0; frame < frameCount; ++frame)
+	{
+		const std::size_t scriptFrame = loop ? (frame % script.getFrameCount()) : frame;
+
+		Arduboy2Base::setHostButtons(script.getButtons(scriptFrame));
+
+		const std::uint32_t paintCount = Arduboy2Core::getHostPaintCount();
+
+		// Fast-forwarding doesn't wait for frames, so it's left to run one move per frame.
+		if(!fast)
+		{
+			Arduboy2Base::setHostFrameDue(false);
+
+			for(std::size_t idleLoop = 0; idleLoop < idleLoopsPerFrame; ++idleLoop)
+				game.loop();
+
+			Arduboy2Base::setHostFrameDue(true);
+		}
+
+		game.loop();
+
+		if(idleFrameCountGiven && (frame >= (frameCount - idleFrameCount)) && (Arduboy2Core::getHostPaintCount() != paintCount))
+			++busyFrameCount;
+	}
+
+	const std::chrono::duration<double> elapsed = (std::chrono::steady_clock::now() - start);
+
+	const double framesPerSecond = (elapsed.count() > 0) ? (frameCount / elapsed.count()) : 0;
+
+	std::printf("%zu frames in %.3fs (%.0f frames/s), screen hash %016llx\n",
+		frameCount, elapsed.count(), framesPerSecond, static_cast<unsigned long long>(hashScreen()));
+
+	if(EEPROMClass::getHostWriteCount() > 0)
+		std::printf("%lu EEPROM bytes written\n", static_cast<unsigned long>(EEPROMClass::getHostWriteCount()));
+
+	if(!pbmPath.empty() || !recordPath.empty() || !eepromPath.empty())
+	{
+		try
+		{
+			if(!pbmPath.empty())
+				saveScreen(pbmPath);
+
+			if(!recordPath.empty())
+				saveReplay(recordPath);
+
+			if(!eepromPath.empty())
+				saveEeprom(eepromPath);
+		}
+		catch(const std::exception & exception)
+		{
+			std::fprintf(stderr, "floorfall-headless: %s\n", exception.what());
+			return 2;
+		}
+	}
+
+	if(idleFrameCountGiven && (busyFrameCount > 0))
+	{
+		std::fprintf(stderr, "floorfall-headless: %zu of the last %zu frames were sent to the display, but none should have been\n", busyFrameCount, idleFrameCount);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
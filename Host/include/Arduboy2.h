@@ -0,0 +1,298 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// A stand-in for the Arduboy2 library for host builds.
+//
+// Only the parts of the API that the game uses are provided,
+// but those parts behave like the real thing:
+// the screen buffer has the same page layout,
+// and sprites and text are drawn into it pixel-for-pixel as they would be.
+//
+// There is no hardware behind it, so:
+// * 'nextFrame' never waits, every call is a new frame
+//   (unless 'setHostFrameDue' says otherwise).
+// * 'display' and 'paint8Pixels' write into an imitation of the display's memory,
+//   which the host reads with 'getHostDisplay'.
+// * the buttons are whatever 'setHostButtons' was last given.
+
+// For uint8_t, int16_t, uint16_t
+#include <stdint.h>
+
+// For size_t
+#include <stddef.h>
+
+// For rand
+#include <stdlib.h>
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+#include <EEPROM.h>
+#include <WString.h>
+#include <Print.h>
+
+#include <Sprites.h>
+
+#define LEFT_BUTTON 0x20
+#define RIGHT_BUTTON 0x40
+#define UP_BUTTON 0x80
+#define DOWN_BUTTON 0x10
+#define A_BUTTON 0x08
+#define B_BUTTON 0x04
+
+#define BLACK 0
+#define WHITE 1
+#define INVERT 2
+
+#define WIDTH 128
+#define HEIGHT 64
+
+// The first byte of EEPROM that games may use.
+// The bytes before it hold Arduboy2's own settings.
+#define EEPROM_STORAGE_SPACE_START 16
+
+class Arduboy2Core
+{
+protected:
+	// Host only.
+	// What the display is showing, in the same layout as the screen buffer.
+	static uint8_t hostDisplay[(WIDTH * HEIGHT) / 8];
+
+	// Where the next byte sent to the display will go.
+	static uint16_t hostDisplayIndex;
+
+	// How many bytes have been sent to the display.
+	static uint32_t hostPaintCount;
+
+public:
+	// Sends a column of eight pixels to the display.
+	// Like the real display, it moves along to the next column by itself,
+	// and wraps around to the top left corner after the last page.
+	static void paint8Pixels(uint8_t pixels);
+
+	// Host only.
+	// Gets what the display is showing.
+	static const uint8_t * getHostDisplay()
+	{
+		return hostDisplay;
+	}
+
+	// Host only.
+	// Gets how many bytes have been sent to the display,
+	// so that frames which send nothing can be told apart.
+	static uint32_t getHostPaintCount()
+	{
+		return hostPaintCount;
+	}
+};
+
+class Arduboy2Base : public Arduboy2Core
+{
+public:
+	// The screen buffer.
+	// Each byte is a vertical strip of eight pixels, least significant bit at the top,
+	// and each run of 'WIDTH' bytes is one eight pixel tall 'page' of the screen.
+	static uint8_t sBuffer[(WIDTH * HEIGHT) / 8];
+
+	// The number of frames started by 'nextFrame'.
+	static uint16_t frameCount;
+
+protected:
+	static uint8_t currentButtonState;
+	static uint8_t previousButtonState;
+
+	// The buttons the host says are held down.
+	static uint8_t hostButtonState;
+
+	// Whether 'nextFrame' starts a new frame.
+	static bool hostFrameDue;
+
+	static uint8_t frameRate;
+
+public:
+	void begin();
+
+	// What 'begin' does without the logo, which the host doesn't need anyway.
+	static void boot();
+
+	// The host has no up button to hold at power on,
+	// and nothing to wait for, so these do nothing.
+	static void flashlight()
+	{
+	}
+
+	static void systemButtons()
+	{
+	}
+
+	static void waitNoButtons()
+	{
+	}
+
+	static constexpr uint8_t width()
+	{
+		return WIDTH;
+	}
+
+	static constexpr uint8_t height()
+	{
+		return HEIGHT;
+	}
+
+	static uint8_t * getBuffer()
+	{
+		return sBuffer;
+	}
+
+	// Only remembered, the host never waits for the next frame.
+	static void setFrameRate(uint8_t rate)
+	{
+		frameRate = rate;
+	}
+
+	static uint8_t getFrameRate()
+	{
+		return frameRate;
+	}
+
+	// Always starts a new frame.
+	static bool nextFrame();
+
+	static bool everyXFrames(uint8_t frames)
+	{
+		return ((frameCount % frames) == 0);
+	}
+
+	static uint8_t buttonsState()
+	{
+		return hostButtonState;
+	}
+
+	static void pollButtons()
+	{
+		previousButtonState = currentButtonState;
+		currentButtonState = buttonsState();
+	}
+
+	static bool pressed(uint8_t buttons)
+	{
+		return ((buttonsState() & buttons) == buttons);
+	}
+
+	static bool justPressed(uint8_t button)
+	{
+		return (((previousButtonState & button) == 0) && ((currentButtonState & button) != 0));
+	}
+
+	static bool justReleased(uint8_t button)
+	{
+		return (((previousButtonState & button) != 0) && ((currentButtonState & button) == 0));
+	}
+
+	static void clear()
+	{
+		fillScreen(BLACK);
+	}
+
+	// Sends the whole screen buffer to the display.
+	static void display();
+
+	static void fillScreen(uint8_t colour = WHITE);
+
+	static void drawPixel(int16_t x, int16_t y, uint8_t colour = WHITE);
+	static uint8_t getPixel(uint8_t x, uint8_t y);
+
+	static void drawFastHLine(int16_t x, int16_t y, uint8_t width, uint8_t colour = WHITE);
+	static void drawFastVLine(int16_t x, int16_t y, uint8_t height, uint8_t colour = WHITE);
+
+	static void drawRect(int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t colour = WHITE);
+	static void fillRect(int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t colour = WHITE);
+
+	// Host only.
+	// Sets the buttons that 'buttonsState' reports from now on.
+	static void setHostButtons(uint8_t buttons)
+	{
+		hostButtonState = buttons;
+	}
+
+	// Host only.
+	// Sets whether 'nextFrame' starts a new frame or, like an Arduboy
+	// waiting for the next frame, returns false.
+	static void setHostFrameDue(bool due)
+	{
+		hostFrameDue = due;
+	}
+};
+
+class Arduboy2 : public Print, public Arduboy2Base
+{
+public:
+	static constexpr uint8_t characterWidth = 5;
+	static constexpr uint8_t characterHeight = 7;
+	static constexpr uint8_t characterSpacing = 1;
+	static constexpr uint8_t lineSpacing = 1;
+
+	static constexpr uint8_t fullCharacterWidth = (characterWidth + characterSpacing);
+	static constexpr uint8_t fullCharacterHeight = (characterHeight + lineSpacing);
+
+protected:
+	static int16_t cursorX;
+	static int16_t cursorY;
+	static uint8_t textColour;
+	static uint8_t textBackground;
+
+public:
+	using Print::write;
+
+	size_t write(uint8_t character) override;
+
+	// Like the real library, clearing the screen also
+	// puts the cursor back in the top left corner.
+	static void clear()
+	{
+		Arduboy2Base::clear();
+		setCursor(0, 0);
+	}
+
+	static void drawChar(int16_t x, int16_t y, uint8_t character, uint8_t colour, uint8_t background);
+
+	static void setCursor(int16_t x, int16_t y)
+	{
+		cursorX = x;
+		cursorY = y;
+	}
+
+	static int16_t getCursorX()
+	{
+		return cursorX;
+	}
+
+	static int16_t getCursorY()
+	{
+		return cursorY;
+	}
+
+	static void setTextColor(uint8_t colour)
+	{
+		textColour = colour;
+	}
+
+	static void setTextBackground(uint8_t colour)
+	{
+		textBackground = colour;
+	}
+};
\ No newline at end of file
@@ -16,23 +16,13 @@
 //  limitations under the License.
 //
 
-#include <stdint.h>
-#include <avr/pgmspace.h>
-
-#include "../Logic/Tile.h"
+// A stand-in for the parts of the Arduino core that the game uses directly,
+// for host builds. Arduboy2.h includes it, as the real Arduboy2.h does.
 
-namespace Levels
-{
-	constexpr uint8_t level1[] PROGMEM
-	{
-		// Width, Height
-		5, 1,
-
-		// Player X, Player Y
-		0, 0,
+// For uint32_t
+#include <stdint.h>
 
-		toTileByte(Tile::makeSolidTile(), Tile::makeBrokenTile(1)),
-		toTileByte(Tile::makeOffButton(), Tile::makeBrokenTile(1)),
-		toTileByte(Tile::makeOffButton(), Tile::makeEmptyTile()),
-	};
-}
\ No newline at end of file
+// The number of microseconds since the program started.
+// Like the real thing, it wraps around after about 70 minutes,
+// so only the difference between two readings means anything.
+uint32_t micros();
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// A stand-in for the Arduino core's EEPROM library for host builds.
+//
+// The EEPROM is just an array, which starts out erased (every byte 0xFF)
+// like a brand new Arduboy's.
+// The host can fill it and read it back with 'getHostData',
+// and count how many bytes have actually been written with 'getHostWriteCount',
+// to see how much wear the game would cause.
+
+// For uint8_t, uint16_t, uint32_t
+#include <stdint.h>
+
+class EEPROMClass
+{
+public:
+	// The size of the ATmega32U4's EEPROM.
+	static constexpr uint16_t size = 1024;
+
+private:
+	static uint8_t hostData[size];
+	static uint32_t hostWriteCount;
+
+public:
+	static uint8_t read(int address)
+	{
+		return hostData[address];
+	}
+
+	static void write(int address, uint8_t value)
+	{
+		hostData[address] = value;
+		++hostWriteCount;
+	}
+
+	// Only writes the byte if it's different, to save wear.
+	static void update(int address, uint8_t value)
+	{
+		if(hostData[address] != value)
+			write(address, value);
+	}
+
+	static constexpr uint16_t length()
+	{
+		return size;
+	}
+
+	static uint8_t * getHostData()
+	{
+		return hostData;
+	}
+
+	static uint32_t getHostWriteCount()
+	{
+		return hostWriteCount;
+	}
+};
+
+extern EEPROMClass EEPROM;
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// A stand-in for the Arduino core's <Print.h> for host builds.
+// Everything funnels through 'write(uint8_t)',
+// just as it does on the real thing.
+
+// For size_t
+#include <stddef.h>
+
+// For uint8_t
+#include <stdint.h>
+
+// For __FlashStringHelper
+#include <WString.h>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print
+{
+public:
+	virtual ~Print() = default;
+
+	virtual size_t write(uint8_t character) = 0;
+
+	size_t write(const char * string);
+	size_t write(const uint8_t * buffer, size_t size);
+
+	size_t print(const __FlashStringHelper * string);
+	size_t print(const char * string);
+	size_t print(char character);
+	size_t print(unsigned char value, int base = DEC);
+	size_t print(int value, int base = DEC);
+	size_t print(unsigned int value, int base = DEC);
+	size_t print(long value, int base = DEC);
+	size_t print(unsigned long value, int base = DEC);
+
+	size_t println();
+	size_t println(const __FlashStringHelper * string);
+	size_t println(const char * string);
+	size_t println(char character);
+	size_t println(unsigned char value, int base = DEC);
+	size_t println(int value, int base = DEC);
+	size_t println(unsigned int value, int base = DEC);
+	size_t println(long value, int base = DEC);
+	size_t println(unsigned long value, int base = DEC);
+
+private:
+	size_t printNumber(unsigned long value, int base);
+};
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// A stand-in for Arduboy2's <Sprites.h> for host builds.
+//
+// Sprites are in the usual format: width, height,
+// then each frame as 'height / 8' pages of 'width' bytes.
+
+// For uint8_t, int16_t
+#include <stdint.h>
+
+class Sprites
+{
+public:
+	// Draws every pixel of the frame, set or not.
+	static void drawOverwrite(int16_t x, int16_t y, const uint8_t * bitmap, uint8_t frame);
+
+	// Draws only the set pixels of the frame.
+	static void drawSelfMasked(int16_t x, int16_t y, const uint8_t * bitmap, uint8_t frame);
+
+	// Clears the pixels that are set in the frame.
+	static void drawErase(int16_t x, int16_t y, const uint8_t * bitmap, uint8_t frame);
+
+private:
+	enum class Mode : uint8_t
+	{
+		Overwrite,
+		SelfMasked,
+		Erase,
+	};
+
+	static void draw(int16_t x, int16_t y, const uint8_t * bitmap, uint8_t frame, Mode mode);
+};
\ No newline at end of file
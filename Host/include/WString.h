@@ -16,20 +16,13 @@
 //  limitations under the License.
 //
 
-// For PROGMEM
-#include <avr/pgmspace.h>
-
-#include "../Language.h"
+// A stand-in for the Arduino core's <WString.h> for host builds.
+// Only the flash string helper is provided, the 'String' class is not.
 
-// Predeclare template.
-template<Language language>
-struct LanguageStrings;
+// For PSTR
+#include <avr/pgmspace.h>
 
-// Specialise template.
-template<>
-struct LanguageStrings<Language::EN_GB>
-{
-	static constexpr char pressA[] PROGMEM = "Press A";
+// Never defined, only ever pointed to.
+class __FlashStringHelper;
 
-	static constexpr char level[] PROGMEM = "Level ";
-};
\ No newline at end of file
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// A stand-in for avr-libc's <avr/pgmspace.h> for host builds.
+// On a PC there is only one address space,
+// so 'progmem' is just ordinary read-only memory.
+
+// For uint8_t, uint16_t, uint32_t
+#include <stdint.h>
+
+// For strlen, memcpy
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+
+// On AVR this places the string literal in progmem.
+#define PSTR(string_literal) (string_literal)
+
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+#define pgm_read_word(address) (*reinterpret_cast<const uint16_t *>(address))
+#define pgm_read_dword(address) (*reinterpret_cast<const uint32_t *>(address))
+#define pgm_read_ptr(address) (*reinterpret_cast<const void * const *>(address))
+
+#define strlen_P(string) strlen(string)
+#define memcpy_P(destination, source, size) memcpy((destination), (source), (size))
\ No newline at end of file
@@ -0,0 +1,300 @@
+#include <Arduboy2.h>
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For memset
+#include <string.h>
+
+uint8_t Arduboy2Core::hostDisplay[(WIDTH * HEIGHT) / 8] {};
+uint16_t Arduboy2Core::hostDisplayIndex { 0 };
+uint32_t Arduboy2Core::hostPaintCount { 0 };
+
+uint8_t Arduboy2Base::sBuffer[(WIDTH * HEIGHT) / 8] {};
+uint16_t Arduboy2Base::frameCount { 0 };
+
+uint8_t Arduboy2Base::currentButtonState { 0 };
+uint8_t Arduboy2Base::previousButtonState { 0 };
+uint8_t Arduboy2Base::hostButtonState { 0 };
+bool Arduboy2Base::hostFrameDue { true };
+
+uint8_t Arduboy2Base::frameRate { 60 };
+
+int16_t Arduboy2::cursorX { 0 };
+int16_t Arduboy2::cursorY { 0 };
+uint8_t Arduboy2::textColour { WHITE };
+uint8_t Arduboy2::textBackground { BLACK };
+
+namespace
+{
+	// A 5x7 font covering printable ASCII.
+	// Each glyph is five columns, least significant bit at the top.
+	constexpr uint8_t firstCharacter = 0x20;
+	constexpr uint8_t lastCharacter = 0x7E;
+
+	constexpr uint8_t font[][Arduboy2::characterWidth]
+	{
+		{ 0x00, 0x00, 0x00, 0x00, 0x00 },	// ' '
+		{ 0x00, 0x00, 0x5F, 0x00, 0x00 },	// '!'
+		{ 0x00, 0x07, 0x00, 0x07, 0x00 },	// '"'
+		{ 0x14, 0x7F, 0x14, 0x7F, 0x14 },	// '#'
+		{ 0x24, 0x2A, 0x7F, 0x2A, 0x12 },	// '$'
+		{ 0x23, 0x13, 0x08, 0x64, 0x62 },	// '%'
+		{ 0x36, 0x49, 0x55, 0x22, 0x50 },	// '&'
+		{ 0x00, 0x04, 0x03, 0x00, 0x00 },	// '\''
+		{ 0x00, 0x1C, 0x22, 0x41, 0x00 },	// '('
+		{ 0x00, 0x41, 0x22, 0x1C, 0x00 },	// ')'
+		{ 0x14, 0x08, 0x3E, 0x08, 0x14 },	// '*'
+		{ 0x08, 0x08, 0x3E, 0x08, 0x08 },	// '+'
+		{ 0x00, 0x50, 0x30, 0x00, 0x00 },	// ','
+		{ 0x08, 0x08, 0x08, 0x08, 0x08 },	// '-'
+		{ 0x00, 0x60, 0x60, 0x00, 0x00 },	// '.'
+		{ 0x20, 0x10, 0x08, 0x04, 0x02 },	// '/'
+		{ 0x3E, 0x51, 0x49, 0x45, 0x3E },	// '0'
+		{ 0x00, 0x42, 0x7F, 0x40, 0x00 },	// '1'
+		{ 0x42, 0x61, 0x51, 0x49, 0x46 },	// '2'
+		{ 0x21, 0x41, 0x45, 0x4B, 0x31 },	// '3'
+		{ 0x18, 0x14, 0x12, 0x7F, 0x10 },	// '4'
+		{ 0x27, 0x45, 0x45, 0x45, 0x39 },	// '5'
+		{ 0x3C, 0x4A, 0x49, 0x49, 0x30 },	// '6'
+		{ 0x01, 0x71, 0x09, 0x05, 0x03 },	// '7'
+		{ 0x36, 0x49, 0x49, 0x49, 0x36 },	// '8'
+		{ 0x06, 0x49, 0x49, 0x29, 0x1E },	// '9'
+		{ 0x00, 0x36, 0x36, 0x00, 0x00 },	// ':'
+		{ 0x00, 0x56, 0x36, 0x00, 0x00 },	// ';'
+		{ 0x08, 0x14, 0x22, 0x41, 0x00 },	// '<'
+		{ 0x14, 0x14, 0x14, 0x14, 0x14 },	// '='
+		{ 0x00, 0x41, 0x22, 0x14, 0x08 },	// '>'
+		{ 0x02, 0x01, 0x51, 0x09, 0x06 },	// '?'
+		{ 0x32, 0x49, 0x79, 0x41, 0x3E },	// '@'
+		{ 0x7E, 0x09, 0x09, 0x09, 0x7E },	// 'A'
+		{ 0x7F, 0x49, 0x49, 0x49, 0x36 },	// 'B'
+		{ 0x3E, 0x41, 0x41, 0x41, 0x22 },	// 'C'
+		{ 0x7F, 0x41, 0x41, 0x22, 0x1C },	// 'D'
+		{ 0x7F, 0x49, 0x49, 0x49, 0x41 },	// 'E'
+		{ 0x7F, 0x09, 0x09, 0x09, 0x01 },	// 'F'
+		{ 0x3E, 0x41, 0x49, 0x49, 0x7A },	// 'G'
+		{ 0x7F, 0x08, 0x08, 0x08, 0x7F },	// 'H'
+		{ 0x00, 0x41, 0x7F, 0x41, 0x00 },	// 'I'
+		{ 0x20, 0x40, 0x41, 0x3F, 0x01 },	// 'J'
+		{ 0x7F, 0x08, 0x14, 0x22, 0x41 },	// 'K'
+		{ 0x7F, 0x40, 0x40, 0x40, 0x40 },	// 'L'
+		{ 0x7F, 0x02, 0x0C, 0x02, 0x7F },	// 'M'
+		{ 0x7F, 0x04, 0x08, 0x10, 0x7F },	// 'N'
+		{ 0x3E, 0x41, 0x41, 0x41, 0x3E },	// 'O'
+		{ 0x7F, 0x09, 0x09, 0x09, 0x06 },	// 'P'
+		{ 0x3E, 0x41, 0x51, 0x21, 0x5E },	// 'Q'
+		{ 0x7F, 0x09, 0x19, 0x29, 0x46 },	// 'R'
+		{ 0x46, 0x49, 0x49, 0x49, 0x31 },	// 'S'
+		{ 0x01, 0x01, 0x7F, 0x01, 0x01 },	// 'T'
+		{ 0x3F, 0x40, 0x40, 0x40, 0x3F },	// 'U'
+		{ 0x1F, 0x20, 0x40, 0x20, 0x1F },	// 'V'
+		{ 0x3F, 0x40, 0x38, 0x40, 0x3F },	// 'W'
+		{ 0x63, 0x14, 0x08, 0x14, 0x63 },	// 'X'
+		{ 0x07, 0x08, 0x70, 0x08, 0x07 },	// 'Y'
+		{ 0x61, 0x51, 0x49, 0x45, 0x43 },	// 'Z'
+		{ 0x00, 0x7F, 0x41, 0x41, 0x00 },	// '['
+		{ 0x02, 0x04, 0x08, 0x10, 0x20 },	// '\\'
+		{ 0x00, 0x41, 0x41, 0x7F, 0x00 },	// ']'
+		{ 0x04, 0x02, 0x01, 0x02, 0x04 },	// '^'
+		{ 0x40, 0x40, 0x40, 0x40, 0x40 },	// '_'
+		{ 0x00, 0x01, 0x02, 0x04, 0x00 },	// '`'
+		{ 0x20, 0x54, 0x54, 0x54, 0x78 },	// 'a'
+		{ 0x7F, 0x48, 0x44, 0x44, 0x38 },	// 'b'
+		{ 0x38, 0x44, 0x44, 0x44, 0x20 },	// 'c'
+		{ 0x38, 0x44, 0x44, 0x48, 0x7F },	// 'd'
+		{ 0x38, 0x54, 0x54, 0x54, 0x18 },	// 'e'
+		{ 0x08, 0x7E, 0x09, 0x01, 0x02 },	// 'f'
+		{ 0x0C, 0x52, 0x52, 0x52, 0x3E },	// 'g'
+		{ 0x7F, 0x08, 0x04, 0x04, 0x78 },	// 'h'
+		{ 0x00, 0x44, 0x7D, 0x40, 0x00 },	// 'i'
+		{ 0x20, 0x40, 0x44, 0x3D, 0x00 },	// 'j'
+		{ 0x7F, 0x10, 0x28, 0x44, 0x00 },	// 'k'
+		{ 0x00, 0x41, 0x7F, 0x40, 0x00 },	// 'l'
+		{ 0x7C, 0x04, 0x18, 0x04, 0x78 },	// 'm'
+		{ 0x7C, 0x08, 0x04, 0x04, 0x78 },	// 'n'
+		{ 0x38, 0x44, 0x44, 0x44, 0x38 },	// 'o'
+		{ 0x7C, 0x14, 0x14, 0x14, 0x08 },	// 'p'
+		{ 0x08, 0x14, 0x14, 0x18, 0x7C },	// 'q'
+		{ 0x7C, 0x08, 0x04, 0x04, 0x08 },	// 'r'
+		{ 0x48, 0x54, 0x54, 0x54, 0x20 },	// 's'
+		{ 0x04, 0x3F, 0x44, 0x40, 0x20 },	// 't'
+		{ 0x3C, 0x40, 0x40, 0x20, 0x7C },	// 'u'
+		{ 0x1C, 0x20, 0x40, 0x20, 0x1C },	// 'v'
+		{ 0x3C, 0x40, 0x30, 0x40, 0x3C },	// 'w'
+		{ 0x44, 0x28, 0x10, 0x28, 0x44 },	// 'x'
+		{ 0x0C, 0x50, 0x50, 0x50, 0x3C },	// 'y'
+		{ 0x44, 0x64, 0x54, 0x4C, 0x44 },	// 'z'
+		{ 0x00, 0x08, 0x36, 0x41, 0x00 },	// '{'
+		{ 0x00, 0x00, 0x7F, 0x00, 0x00 },	// '|'
+		{ 0x00, 0x41, 0x36, 0x08, 0x00 },	// '}'
+		{ 0x08, 0x04, 0x08, 0x10, 0x08 },	// '~'
+	};
+
+	// The right-pointing triangle (code 0x10 in the real font),
+	// which the level select uses as a cursor.
+	constexpr uint8_t rightTriangleCharacter = 0x10;
+	constexpr uint8_t rightTriangle[Arduboy2::characterWidth] { 0x7F, 0x3E, 0x1C, 0x08, 0x00 };
+
+	// Anything else is drawn as a hollow box.
+	constexpr uint8_t unknown[Arduboy2::characterWidth] { 0x7F, 0x41, 0x41, 0x41, 0x7F };
+
+	const uint8_t * getGlyph(uint8_t character)
+	{
+		if((character >= firstCharacter) && (character <= lastCharacter))
+			return font[character - firstCharacter];
+
+		if(character == rightTriangleCharacter)
+			return rightTriangle;
+
+		return unknown;
+	}
+}
+
+void Arduboy2Core::paint8Pixels(uint8_t pixels)
+{
+	hostDisplay[hostDisplayIndex] = pixels;
+	hostDisplayIndex = static_cast<uint16_t>((hostDisplayIndex + 1) % sizeof(hostDisplay));
+	++hostPaintCount;
+}
+
+void Arduboy2Base::begin()
+{
+	clear();
+	boot();
+}
+
+void Arduboy2Base::boot()
+{
+	frameCount = 0;
+	currentButtonState = 0;
+	previousButtonState = 0;
+}
+
+bool Arduboy2Base::nextFrame()
+{
+	if(!hostFrameDue)
+		return false;
+
+	++frameCount;
+	return true;
+}
+
+void Arduboy2Base::display()
+{
+	for(const uint8_t pixels : sBuffer)
+		paint8Pixels(pixels);
+}
+
+void Arduboy2Base::fillScreen(uint8_t colour)
+{
+	memset(sBuffer, (colour == BLACK) ? 0x00 : 0xFF, sizeof(sBuffer));
+}
+
+void Arduboy2Base::drawPixel(int16_t x, int16_t y, uint8_t colour)
+{
+	if((x < 0) || (x >= WIDTH) || (y < 0) || (y >= HEIGHT))
+		return;
+
+	uint8_t & byte = sBuffer[((y / 8) * WIDTH) + x];
+	const uint8_t mask = static_cast<uint8_t>(1 << (y % 8));
+
+	switch(colour)
+	{
+		case BLACK:
+			byte &= static_cast<uint8_t>(~mask);
+			break;
+
+		case INVERT:
+			byte ^= mask;
+			break;
+
+		default:
+			byte |= mask;
+			break;
+	}
+}
+
+uint8_t Arduboy2Base::getPixel(uint8_t x, uint8_t y)
+{
+	if((x >= WIDTH) || (y >= HEIGHT))
+		return BLACK;
+
+	return ((sBuffer[((y / 8) * WIDTH) + x] >> (y % 8)) & 1) ? WHITE : BLACK;
+}
+
+void Arduboy2Base::drawFastHLine(int16_t x, int16_t y, uint8_t width, uint8_t colour)
+{
+	for(uint8_t offset = 0; offset < width; ++offset)
+		drawPixel(x + offset, y, colour);
+}
+
+void Arduboy2Base::drawFastVLine(int16_t x, int16_t y, uint8_t height, uint8_t colour)
+{
+	for(uint8_t offset = 0; offset < height; ++offset)
+		drawPixel(x, y + offset, colour);
+}
+
+void Arduboy2Base::drawRect(int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t colour)
+{
+	if((width == 0) || (height == 0))
+		return;
+
+	drawFastHLine(x, y, width, colour);
+	drawFastHLine(x, y + height - 1, width, colour);
+	drawFastVLine(x, y, height, colour);
+	drawFastVLine(x + width - 1, y, height, colour);
+}
+
+void Arduboy2Base::fillRect(int16_t x, int16_t y, uint8_t width, uint8_t height, uint8_t colour)
+{
+	for(uint8_t offset = 0; offset < width; ++offset)
+		drawFastVLine(x + offset, y, height, colour);
+}
+
+size_t Arduboy2::write(uint8_t character)
+{
+	// Carriage returns are ignored and line feeds start a new line,
+	// as with the real library.
+	if(character == '\r')
+		return 1;
+
+	if(character == '\n')
+	{
+		cursorX = 0;
+		cursorY += fullCharacterHeight;
+		return 1;
+	}
+
+	drawChar(cursorX, cursorY, character, textColour, textBackground);
+	cursorX += fullCharacterWidth;
+	return 1;
+}
+
+void Arduboy2::drawChar(int16_t x, int16_t y, uint8_t character, uint8_t colour, uint8_t background)
+{
+	const uint8_t * glyph = getGlyph(character);
+
+	// The whole character cell is drawn, background included,
+	// so text overwrites whatever was underneath it.
+	for(uint8_t column = 0; column < fullCharacterWidth; ++column)
+	{
+		const uint8_t bits = (column < characterWidth) ? glyph[column] : 0;
+
+		for(uint8_t row = 0; row < fullCharacterHeight; ++row)
+			drawPixel(x + column, y + row, (((bits >> row) & 1) != 0) ? colour : background);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include <EEPROM.h>
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For memset
+#include <string.h>
+
+EEPROMClass EEPROM;
+
+uint8_t EEPROMClass::hostData[EEPROMClass::size] {};
+uint32_t EEPROMClass::hostWriteCount { 0 };
+
+namespace
+{
+	// Erased EEPROM reads as all ones,
+	// so fill it before anything else can read it.
+	struct Eraser
+	{
+		Eraser()
+		{
+			memset(EEPROMClass::getHostData(), 0xFF, EEPROMClass::size);
+		}
+	};
+
+	Eraser eraser;
+}
\ No newline at end of file
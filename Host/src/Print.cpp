@@ -0,0 +1,188 @@
+#include <Print.h>
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <avr/pgmspace.h>
+
+size_t Print::write(const char * string)
+{
+	size_t count = 0;
+
+	while(*string != '\0')
+	{
+		count += this->write(static_cast<uint8_t>(*string));
+		++string;
+	}
+
+	return count;
+}
+
+size_t Print::write(const uint8_t * buffer, size_t size)
+{
+	size_t count = 0;
+
+	for(size_t index = 0; index < size; ++index)
+		count += this->write(buffer[index]);
+
+	return count;
+}
+
+size_t Print::print(const __FlashStringHelper * string)
+{
+	// Read the string a character at a time, just like the real thing.
+	const auto pointer = reinterpret_cast<const char *>(string);
+
+	size_t count = 0;
+
+	for(size_t index = 0;; ++index)
+	{
+		const char character = static_cast<char>(pgm_read_byte(&pointer[index]));
+
+		if(character == '\0')
+			break;
+
+		count += this->write(static_cast<uint8_t>(character));
+	}
+
+	return count;
+}
+
+size_t Print::print(const char * string)
+{
+	return this->write(string);
+}
+
+size_t Print::print(char character)
+{
+	return this->write(static_cast<uint8_t>(character));
+}
+
+size_t Print::print(unsigned char value, int base)
+{
+	return this->print(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(int value, int base)
+{
+	return this->print(static_cast<long>(value), base);
+}
+
+size_t Print::print(unsigned int value, int base)
+{
+	return this->print(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(long value, int base)
+{
+	// Like the Arduino core, only decimal numbers get a minus sign.
+	if((base == DEC) && (value < 0))
+	{
+		const size_t count = this->print('-');
+		return count + this->printNumber(0ul - static_cast<unsigned long>(value), base);
+	}
+
+	return this->printNumber(static_cast<unsigned long>(value), base);
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+	return this->printNumber(value, base);
+}
+
+size_t Print::println()
+{
+	return this->write("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper * string)
+{
+	const size_t count = this->print(string);
+	return count + this->println();
+}
+
+size_t Print::println(const char * string)
+{
+	const size_t count = this->print(string);
+	return count + this->println();
+}
+
+size_t Print::println(char character)
+{
+	const size_t count = this->print(character);
+	return count + this->println();
+}
+
+size_t Print::println(unsigned char value, int base)
+{
+	const size_t count = this->print(value, base);
+	return count + this->println();
+}
+
+size_t Print::println(int value, int base)
+{
+	const size_t count = this->print(value, base);
+	return count + this->println();
+}
+
+size_t Print::println(unsigned int value, int base)
+{
+	const size_t count = this->print(value, base);
+	return count + this->println();
+}
+
+size_t Print::println(long value, int base)
+{
+	const size_t count = this->print(value, base);
+	return count + this->println();
+}
+
+size_t Print::println(unsigned long value, int base)
+{
+	const size_t count = this->print(value, base);
+	return count + this->println();
+}
+
+size_t Print::printNumber(unsigned long value, int base)
+{
+	// Bases below two make no sense, so treat them as decimal.
+	if(base < 2)
+		base = DEC;
+
+	// Enough for a 64-bit number in binary.
+	char buffer[64];
+	size_t length = 0;
+
+	// Produce the digits backwards.
+	do
+	{
+		const auto digit = static_cast<char>(value % static_cast<unsigned long>(base));
+		buffer[length] = (digit < 10) ? static_cast<char>('0' + digit) : static_cast<char>('A' + (digit - 10));
+		++length;
+		value /= static_cast<unsigned long>(base);
+	}
+	while(value != 0);
+
+	size_t count = 0;
+
+	while(length > 0)
+	{
+		--length;
+		count += this->write(static_cast<uint8_t>(buffer[length]));
+	}
+
+	return count;
+}
\ No newline at end of file
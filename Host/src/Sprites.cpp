@@ -0,0 +1,111 @@
+#include <Sprites.h>
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// For size_t
+#include <stddef.h>
+
+#include <avr/pgmspace.h>
+#include <Arduboy2.h>
+
+void Sprites::drawOverwrite(int16_t x, int16_t y, const uint8_t * bitmap, uint8_t frame)
+{
+	draw(x, y, bitmap, frame, Mode::Overwrite);
+}
+
+void Sprites::drawSelfMasked(int16_t x, int16_t y, const uint8_t * bitmap, uint8_t frame)
+{
+	draw(x, y, bitmap, frame, Mode::SelfMasked);
+}
+
+void Sprites::drawErase(int16_t x, int16_t y, const uint8_t * bitmap, uint8_t frame)
+{
+	draw(x, y, bitmap, frame, Mode::Erase);
+}
+
+void Sprites::draw(int16_t x, int16_t y, const uint8_t * bitmap, uint8_t frame, Mode mode)
+{
+	const uint8_t width = pgm_read_byte(&bitmap[0]);
+	const uint8_t height = pgm_read_byte(&bitmap[1]);
+	const uint8_t pages = ((height + 7) / 8);
+
+	const size_t frameSize = (static_cast<size_t>(width) * pages);
+	const uint8_t * data = &bitmap[2 + (frame * frameSize)];
+
+	// A sprite that isn't aligned to a page straddles two pages,
+	// so each byte of the sprite is split between two bytes of the buffer.
+	// (Masking with 7 and subtracting rounds towards negative infinity,
+	// which matters for sprites that hang off of the top of the screen.)
+	const uint8_t shift = static_cast<uint8_t>(y & 7);
+	const int16_t firstPage = ((y - shift) / 8);
+
+	constexpr int16_t screenPages = (HEIGHT / 8);
+
+	uint8_t * buffer = Arduboy2Base::getBuffer();
+
+	for(uint8_t page = 0; page < pages; ++page)
+	{
+		const int16_t upperPage = (firstPage + page);
+		const int16_t lowerPage = (upperPage + 1);
+
+		for(uint8_t column = 0; column < width; ++column)
+		{
+			const int16_t screenX = (x + column);
+
+			if((screenX < 0) || (screenX >= WIDTH))
+				continue;
+
+			const uint16_t bits = static_cast<uint16_t>(pgm_read_byte(&data[(page * width) + column]) << shift);
+			const uint16_t mask = static_cast<uint16_t>(0xFF << shift);
+
+			const uint8_t parts[2][2]
+			{
+				{ static_cast<uint8_t>(bits), static_cast<uint8_t>(mask) },
+				{ static_cast<uint8_t>(bits >> 8), static_cast<uint8_t>(mask >> 8) },
+			};
+
+			const int16_t targets[2] { upperPage, lowerPage };
+
+			for(uint8_t part = 0; part < 2; ++part)
+			{
+				const int16_t target = targets[part];
+
+				if((target < 0) || (target >= screenPages))
+					continue;
+
+				uint8_t & byte = buffer[(target * WIDTH) + screenX];
+				const uint8_t partBits = parts[part][0];
+				const uint8_t partMask = parts[part][1];
+
+				switch(mode)
+				{
+					case Mode::Overwrite:
+						byte = static_cast<uint8_t>((byte & ~partMask) | partBits);
+						break;
+
+					case Mode::SelfMasked:
+						byte |= partBits;
+						break;
+
+					case Mode::Erase:
+						byte &= static_cast<uint8_t>(~partBits);
+						break;
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "ImageEncoder.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <limits>
+#include <stdexcept>
+
+#include "Rendering/ImageCodec.h"
+
+namespace
+{
+	// A way of encoding the columns up to some point.
+	struct Step
+	{
+		// The bytes needed for every column so far.
+		std::size_t cost { std::numeric_limits<std::size_t>::max() };
+
+		// The run that ends here, and the tag it starts with.
+		std::size_t length { 0 };
+		std::uint8_t tag { 0 };
+
+		// The byte after the tag of a fill or a copy.
+		std::uint8_t argument { 0 };
+	};
+
+	void consider(Step & step, std::size_t cost, std::size_t length, std::uint8_t tag, std::uint8_t argument)
+	{
+		if(cost < step.cost)
+			step = Step { cost, length, tag, argument };
+	}
+
+	// Finds the cheapest series of runs for one page,
+	// trying every run that could end at each column.
+	void compressPage(const std::uint8_t * page, std::size_t width, std::vector<std::uint8_t> & output)
+	{
+		std::vector<Step> steps(width + 1);
+		steps[0].cost = 0;
+
+		for(std::size_t end = 1; end <= width; ++end)
+		{
+			Step & step = steps[end];
+
+			// Literals.
+			for(std::size_t length = 1; (length <= ImageCodec::maximumLiteral) && (length <= end); ++length)
+				consider(step, steps[end - length].cost + 1 + length, length, static_cast<std::uint8_t>(length - 1), 0);
+
+			// Fills, of the last byte.
+			for(std::size_t length = 1; (length <= ImageCodec::maximumFill) && (length <= end) && (page[end - length] == page[end - 1]); ++length)
+				if(length >= ImageCodec::minimumFill)
+					consider(step, steps[end - length].cost + 2, length, static_cast<std::uint8_t>(ImageCodec::repeatFlag | (length - ImageCodec::minimumFill)), page[end - 1]);
+
+			// Copies, from any distance that matches.
+			for(std::size_t length = ImageCodec::minimumCopy; (length <= ImageCodec::maximumCopy) && (length <= end); ++length)
+			{
+				const std::size_t start = (end - length);
+
+				for(std::size_t distance = 1; (distance <= ImageCodec::maximumDistance) && (distance <= start); ++distance)
+				{
+					// Columns are copied one at a time, so the copy can overlap itself.
+					bool matches = true;
+
+					for(std::size_t offset = 0; matches && (offset < length); ++offset)
+						matches = (page[start + offset] == page[start + offset - distance]);
+
+					if(matches)
+					{
+						consider(step, steps[start].cost + 2, length, static_cast<std::uint8_t>(ImageCodec::repeatFlag | ImageCodec::copyFlag | (length - ImageCodec::minimumCopy)), static_cast<std::uint8_t>(distance));
+						break;
+					}
+				}
+			}
+		}
+
+		// Follow the cheapest runs back from the end, then write them out in order.
+		std::vector<std::size_t> ends;
+
+		for(std::size_t end = width; end > 0; end -= steps[end].length)
+			ends.push_back(end);
+
+		for(auto iterator = ends.rbegin(); iterator != ends.rend(); ++iterator)
+		{
+			const Step & step = steps[*iterator];
+
+			output.push_back(step.tag);
+
+			if((step.tag & ImageCodec::repeatFlag) == 0)
+				output.insert(output.end(), &page[*iterator - step.length], &page[*iterator]);
+			else
+				output.push_back(step.argument);
+		}
+	}
+}
+
+std::vector<std::uint8_t> packPages(const Bitmap & bitmap)
+{
+	if((bitmap.width > 0xFF) || (bitmap.height > 0xFF))
+		throw std::runtime_error("the image is bigger than 255x255");
+
+	const std::size_t pageCount = ((bitmap.height + 7) / 8);
+
+	std::vector<std::uint8_t> pages(pageCount * bitmap.width);
+
+	for(std::size_t y = 0; y < bitmap.height; ++y)
+		for(std::size_t x = 0; x < bitmap.width; ++x)
+			if(bitmap.getPixel(x, y))
+				pages[((y / 8) * bitmap.width) + x] |= static_cast<std::uint8_t>(1u << (y % 8));
+
+	return pages;
+}
+
+std::vector<std::uint8_t> compressPages(const std::vector<std::uint8_t> & pages, std::size_t width)
+{
+	std::vector<std::uint8_t> output;
+
+	for(std::size_t start = 0; start < pages.size(); start += width)
+		compressPage(&pages[start], width, output);
+
+	return output;
+}
+
+std::vector<std::uint8_t> decompressPages(const std::vector<std::uint8_t> & data, std::size_t width, std::size_t pageCount)
+{
+	std::vector<std::uint8_t> pages;
+
+	std::size_t position = 0;
+
+	const auto read = [&]() -> std::uint8_t
+	{
+		if(position >= data.size())
+			throw std::runtime_error("the image data ends early");
+
+		return data[position++];
+	};
+
+	for(std::size_t page = 0; page < pageCount; ++page)
+	{
+		const std::size_t start = pages.size();
+
+		while((pages.size() - start) < width)
+		{
+			const std::uint8_t tag = read();
+
+			if((tag & ImageCodec::repeatFlag) == 0)
+			{
+				for(std::size_t length = (tag & ImageCodec::literalLengthMask) + 1u; length > 0; --length)
+					pages.push_back(read());
+			}
+			else if((tag & ImageCodec::copyFlag) == 0)
+			{
+				const std::uint8_t value = read();
+
+				pages.insert(pages.end(), (tag & ImageCodec::repeatLengthMask) + ImageCodec::minimumFill, value);
+			}
+			else
+			{
+				const std::size_t length = ((tag & ImageCodec::repeatLengthMask) + ImageCodec::minimumCopy);
+				const std::size_t distance = read();
+
+				if((distance == 0) || (distance > (pages.size() - start)))
+					throw std::runtime_error("a copy reaches outside of its page");
+
+				for(std::size_t offset = 0; offset < length; ++offset)
+					pages.push_back(pages[pages.size() - distance]);
+			}
+		}
+
+		if((pages.size() - start) != width)
+			throw std::runtime_error("a run carries on into the next page");
+	}
+
+	if(position != data.size())
+		throw std::runtime_error("the image data is too long");
+
+	return pages;
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Png.h"
+
+// Lays a bitmap out as pages of column bytes, as 'Sprites' images are,
+// least significant bit at the top.
+//
+// Throws 'std::runtime_error' if the bitmap is too big to be an image.
+std::vector<std::uint8_t> packPages(const Bitmap & bitmap);
+
+// Compresses pages made by 'packPages' in the format that 'Canvas::drawCompressedImage' reads.
+// (See 'Rendering/ImageCodec.h'.)
+// The result is the smallest encoding possible, without the dimensions.
+std::vector<std::uint8_t> compressPages(const std::vector<std::uint8_t> & pages, std::size_t width);
+
+// Decompresses what 'compressPages' makes, as 'Canvas::drawCompressedImage' would.
+//
+// Throws 'std::runtime_error' if the data is broken.
+std::vector<std::uint8_t> decompressPages(const std::vector<std::uint8_t> & data, std::size_t width, std::size_t pageCount);
\ No newline at end of file
@@ -0,0 +1,200 @@
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// floorfall-imagec
+//
+// Usage:
+//   floorfall-imagec --name NAME [--output HEADER] FILE
+//
+// Reads the PNG FILE, compresses it in the format described by 'Rendering/ImageCodec.h',
+// and writes a header declaring it as 'Images::NAME',
+// along with 'Images::NAMEWidth' and 'Images::NAMEHeight'.
+// Bright, opaque pixels are lit and everything else is dark.
+// The result is decompressed again and checked before it's written.
+// The header is written to HEADER, or printed if there isn't one.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ImageEncoder.h"
+#include "Png.h"
+
+namespace
+{
+	constexpr const char * licence =
+		"//\n"
+		"//  Copyright (C) 2021 Pharap (@Pharap)\n"
+		"//\n"
+		"//  Licensed under the Apache License, Version 2.0 (the \"License\");\n"
+		"//  you may not use this file except in compliance with the License.\n"
+		"//  You may obtain a copy of the License at\n"
+		"//\n"
+		"//       http://www.apache.org/licenses/LICENSE-2.0\n"
+		"//\n"
+		"//  Unless required by applicable law or agreed to in writing, software\n"
+		"//  distributed under the License is distributed on an \"AS IS\" BASIS,\n"
+		"//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
+		"//  See the License for the specific language governing permissions and\n"
+		"//  limitations under the License.\n"
+		"//\n";
+
+	// The number of bytes of image data per line of output.
+	constexpr std::size_t bytesPerLine = 8;
+
+	[[noreturn]] void usage()
+	{
+		std::fprintf(stderr, "usage: floorfall-imagec --name NAME [--output HEADER] FILE\n");
+		std::exit(2);
+	}
+
+	void writeByte(std::ostream & stream, std::uint8_t value)
+	{
+		stream << "0x" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << static_cast<unsigned>(value) << std::dec;
+	}
+
+	void writeBytes(std::ostream & stream, const std::vector<std::uint8_t> & bytes)
+	{
+		for(std::size_t index = 0; index < bytes.size(); index += bytesPerLine)
+		{
+			stream << "\t\t";
+
+			for(std::size_t offset = 0; (offset < bytesPerLine) && ((index + offset) < bytes.size()); ++offset)
+			{
+				if(offset > 0)
+					stream << ' ';
+
+				writeByte(stream, bytes[index + offset]);
+				stream << ',';
+			}
+
+			stream << '\n';
+		}
+	}
+
+	std::string getFileName(const std::string & path)
+	{
+		const auto slash = path.find_last_of("/\\");
+
+		return (slash == std::string::npos) ? path : path.substr(slash + 1);
+	}
+
+	void writeImage(std::ostream & stream, const std::string & name, const std::string & path, const Bitmap & bitmap, const std::vector<std::uint8_t> & pages, const std::vector<std::uint8_t> & data)
+	{
+		stream << "#pragma once\n\n" << licence << '\n';
+		stream << "// Made by floorfall-imagec from " << getFileName(path) << ", don't edit this by hand.\n\n";
+		stream << "// For uint8_t\n#include <stdint.h>\n\n// For PROGMEM\n#include <avr/pgmspace.h>\n\n";
+		stream << "namespace Images\n{\n";
+		stream << "\tconstexpr uint8_t " << name << "Width = " << bitmap.width << ";\n";
+		stream << "\tconstexpr uint8_t " << name << "Height = " << bitmap.height << ";\n\n";
+		stream << "\t// Compressed from " << pages.size() << " bytes to " << data.size() << ".\n";
+		stream << "\t// (Draw it with 'Canvas::drawCompressedImage'.)\n";
+		stream << "\tconstexpr uint8_t " << name << "[] PROGMEM\n\t{\n";
+		stream << "\t\t// Dimensions\n\t\t" << name << "Width, " << name << "Height,\n\n";
+		stream << "\t\t// Runs\n";
+		writeBytes(stream, data);
+		stream << "\t};\n}";
+	}
+}
+
+int main(int argumentCount, char * arguments[])
+{
+	std::string name;
+	std::string outputPath;
+	std::vector<std::string> paths;
+
+	for(int index = 1; index < argumentCount; ++index)
+	{
+		const std::string argument { arguments[index] };
+
+		if((argument == "--name") || (argument == "--output"))
+		{
+			if((index + 1) >= argumentCount)
+				usage();
+
+			const std::string value { arguments[++index] };
+
+			if(argument == "--name")
+				name = value;
+			else
+				outputPath = value;
+		}
+		else if(!argument.empty() && (argument[0] != '-'))
+		{
+			paths.push_back(argument);
+		}
+		else
+		{
+			usage();
+		}
+	}
+
+	if(name.empty() || (paths.size() != 1))
+		usage();
+
+	try
+	{
+		const std::string & path = paths.front();
+
+		const Bitmap bitmap = readPng(path);
+		const std::vector<std::uint8_t> pages = packPages(bitmap);
+		const std::vector<std::uint8_t> data = compressPages(pages, bitmap.width);
+
+		// Make sure the game will see exactly what's in the file.
+		if(decompressPages(data, bitmap.width, (bitmap.height + 7) / 8) != pages)
+			throw std::runtime_error(path + " doesn't survive being compressed");
+
+		std::ostringstream header;
+		writeImage(header, name, path, bitmap, pages, data);
+
+		if(outputPath.empty())
+		{
+			std::cout << header.str() << '\n';
+		}
+		else
+		{
+			// The game's sources use Windows line endings,
+			// so the header should too.
+			std::ofstream output { outputPath, std::ios::binary };
+
+			for(const char character : header.str())
+			{
+				if(character == '\n')
+					output << '\r';
+
+				output << character;
+			}
+
+			if(!output)
+				throw std::runtime_error("can't write " + outputPath);
+		}
+	}
+	catch(const std::exception & exception)
+	{
+		std::fprintf(stderr, "floorfall-imagec: %s\n", exception.what());
+		return 2;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+#include "Png.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include <zlib.h>
+
+namespace
+{
+	constexpr std::array<std::uint8_t, 8> signature { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+	enum ColourType : std::uint8_t
+	{
+		Greyscale = 0,
+		Truecolour = 2,
+		Indexed = 3,
+		GreyscaleAlpha = 4,
+		TruecolourAlpha = 6,
+	};
+
+	std::uint32_t readBigEndian(const std::uint8_t * bytes)
+	{
+		return ((static_cast<std::uint32_t>(bytes[0]) << 24) | (static_cast<std::uint32_t>(bytes[1]) << 16) | (static_cast<std::uint32_t>(bytes[2]) << 8) | bytes[3]);
+	}
+
+	std::size_t getChannelCount(std::uint8_t colourType)
+	{
+		switch(colourType)
+		{
+			case Greyscale: return 1;
+			case Truecolour: return 3;
+			case Indexed: return 1;
+			case GreyscaleAlpha: return 2;
+			case TruecolourAlpha: return 4;
+			default: throw std::runtime_error("unknown colour type");
+		}
+	}
+
+	std::vector<std::uint8_t> inflate(const std::vector<std::uint8_t> & compressed, std::size_t size)
+	{
+		std::vector<std::uint8_t> result(size);
+
+		uLongf resultSize = static_cast<uLongf>(size);
+
+		if(uncompress(result.data(), &resultSize, compressed.data(), static_cast<uLong>(compressed.size())) != Z_OK)
+			throw std::runtime_error("the image data is corrupt");
+
+		if(resultSize != size)
+			throw std::runtime_error("the image data is the wrong size");
+
+		return result;
+	}
+
+	std::uint8_t paeth(std::uint8_t left, std::uint8_t up, std::uint8_t upLeft)
+	{
+		const int estimate = (left + up - upLeft);
+		const int leftDistance = std::abs(estimate - left);
+		const int upDistance = std::abs(estimate - up);
+		const int upLeftDistance = std::abs(estimate - upLeft);
+
+		if((leftDistance <= upDistance) && (leftDistance <= upLeftDistance))
+			return left;
+
+		if(upDistance <= upLeftDistance)
+			return up;
+
+		return upLeft;
+	}
+
+	// Undoes each row's filter, leaving just the bytes of the rows.
+	std::vector<std::uint8_t> unfilter(const std::vector<std::uint8_t> & data, std::size_t rowSize, std::size_t height, std::size_t pixelSize)
+	{
+		std::vector<std::uint8_t> rows(rowSize * height);
+
+		for(std::size_t y = 0; y < height; ++y)
+		{
+			const std::uint8_t filter = data[y * (rowSize + 1)];
+			const std::uint8_t * source = &data[(y * (rowSize + 1)) + 1];
+
+			std::uint8_t * row = &rows[y * rowSize];
+			const std::uint8_t * above = (y > 0) ? &rows[(y - 1) * rowSize] : nullptr;
+
+			for(std::size_t x = 0; x < rowSize; ++x)
+			{
+				const std::uint8_t left = (x >= pixelSize) ? row[x - pixelSize] : 0;
+				const std::uint8_t up = (above != nullptr) ? above[x] : 0;
+				const std::uint8_t upLeft = ((above != nullptr) && (x >= pixelSize)) ? above[x - pixelSize] : 0;
+
+				std::uint8_t prediction;
+
+				switch(filter)
+				{
+					case 0: prediction = 0; break;
+					case 1: prediction = left; break;
+					case 2: prediction = up; break;
+					case 3: prediction = static_cast<std::uint8_t>((left + up) / 2); break;
+					case 4: prediction = paeth(left, up, upLeft); break;
+					default: throw std::runtime_error("unknown row filter");
+				}
+
+				row[x] = static_cast<std::uint8_t>(source[x] + prediction);
+			}
+		}
+
+		return rows;
+	}
+
+	// Reads a sample of 'bitDepth' bits, scaled up to 8 bits unless it's a palette index.
+	std::uint8_t readSample(const std::uint8_t * row, std::size_t index, std::uint8_t bitDepth, bool scale)
+	{
+		if(bitDepth == 8)
+			return row[index];
+
+		const std::size_t bit = (index * bitDepth);
+		const std::uint8_t shift = static_cast<std::uint8_t>(8 - bitDepth - (bit % 8));
+		const std::uint8_t mask = static_cast<std::uint8_t>((1u << bitDepth) - 1);
+		const std::uint8_t sample = static_cast<std::uint8_t>((row[bit / 8] >> shift) & mask);
+
+		return scale ? static_cast<std::uint8_t>((sample * 0xFF) / mask) : sample;
+	}
+}
+
+Bitmap readPng(const std::string & path)
+{
+	std::ifstream file { path, std::ios::binary };
+
+	if(!file)
+		throw std::runtime_error("can't open " + path);
+
+	const std::vector<std::uint8_t> bytes { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+	if((bytes.size() < signature.size()) || !std::equal(signature.begin(), signature.end(), bytes.begin()))
+		throw std::runtime_error(path + " isn't a PNG");
+
+	std::size_t width = 0;
+	std::size_t height = 0;
+	std::uint8_t bitDepth = 0;
+	std::uint8_t colourType = 0;
+	std::vector<std::uint8_t> palette;
+	std::vector<std::uint8_t> paletteAlpha;
+	std::vector<std::uint8_t> compressed;
+
+	// Gather up the chunks that matter, skipping the rest.
+	for(std::size_t position = signature.size(); (position + 12) <= bytes.size();)
+	{
+		const std::size_t length = readBigEndian(&bytes[position]);
+		const std::string type { reinterpret_cast<const char *>(&bytes[position + 4]), 4 };
+		const std::size_t start = (position + 8);
+
+		if((start + length + 4) > bytes.size())
+			throw std::runtime_error(path + " is cut short");
+
+		const std::uint8_t * data = &bytes[start];
+
+		if(type == "IHDR")
+		{
+			if(length < 13)
+				throw std::runtime_error(path + " has a broken header");
+
+			width = readBigEndian(&data[0]);
+			height = readBigEndian(&data[4]);
+			bitDepth = data[8];
+			colourType = data[9];
+
+			if(data[12] != 0)
+				throw std::runtime_error(path + " is interlaced, which isn't supported");
+		}
+		else if(type == "PLTE")
+		{
+			palette.assign(data, data + length);
+		}
+		else if(type == "tRNS")
+		{
+			paletteAlpha.assign(data, data + length);
+		}
+		else if(type == "IDAT")
+		{
+			compressed.insert(compressed.end(), data, data + length);
+		}
+		else if(type == "IEND")
+		{
+			break;
+		}
+
+		position = (start + length + 4);
+	}
+
+	if((width == 0) || (height == 0))
+		throw std::runtime_error(path + " has no pixels");
+
+	// Only 8-bit samples are supported, besides for palette indices.
+	const bool supportedDepth = (colourType == Indexed) ? ((bitDepth == 1) || (bitDepth == 2) || (bitDepth == 4) || (bitDepth == 8)) : (bitDepth == 8);
+
+	if(!supportedDepth)
+		throw std::runtime_error(path + " has " + std::to_string(bitDepth) + "-bit samples, which isn't supported");
+
+	const std::size_t channels = getChannelCount(colourType);
+	const std::size_t rowSize = (((width * channels * bitDepth) + 7) / 8);
+	const std::size_t pixelSize = std::max<std::size_t>(1, (channels * bitDepth) / 8);
+
+	const auto rows = unfilter(inflate(compressed, (rowSize + 1) * height), rowSize, height, pixelSize);
+
+	Bitmap bitmap;
+	bitmap.width = width;
+	bitmap.height = height;
+	bitmap.pixels.resize(width * height);
+
+	for(std::size_t y = 0; y < height; ++y)
+	{
+		const std::uint8_t * row = &rows[y * rowSize];
+
+		for(std::size_t x = 0; x < width; ++x)
+		{
+			std::uint8_t red;
+			std::uint8_t green;
+			std::uint8_t blue;
+			std::uint8_t alpha = 0xFF;
+
+			if(colourType == Indexed)
+			{
+				const std::size_t index = readSample(row, x, bitDepth, false);
+
+				if(((index * 3) + 2) >= palette.size())
+					throw std::runtime_error(path + " uses a colour that isn't in its palette");
+
+				red = palette[(index * 3) + 0];
+				green = palette[(index * 3) + 1];
+				blue = palette[(index * 3) + 2];
+
+				if(index < paletteAlpha.size())
+					alpha = paletteAlpha[index];
+			}
+			else
+			{
+				const std::uint8_t * pixel = &row[x * channels];
+
+				red = pixel[0];
+				green = (channels >= 3) ? pixel[1] : red;
+				blue = (channels >= 3) ? pixel[2] : red;
+
+				if((channels == 2) || (channels == 4))
+					alpha = pixel[channels - 1];
+			}
+
+			// A pixel is lit if it's more light than dark, and more there than not.
+			const unsigned brightness = ((red * 299u) + (green * 587u) + (blue * 114u)) / 1000u;
+
+			bitmap.pixels[(y * width) + x] = ((brightness >= 0x80) && (alpha >= 0x80)) ? 1 : 0;
+		}
+	}
+
+	return bitmap;
+}
\ No newline at end of file
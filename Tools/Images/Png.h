@@ -0,0 +1,47 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A one bit per pixel picture, one byte per pixel for ease of use.
+struct Bitmap
+{
+	std::size_t width { 0 };
+	std::size_t height { 0 };
+
+	// Row by row, top to bottom. Non-zero for a lit pixel.
+	std::vector<std::uint8_t> pixels;
+
+	bool getPixel(std::size_t x, std::size_t y) const
+	{
+		return (this->pixels[(y * this->width) + x] != 0);
+	}
+};
+
+// Reads a PNG, treating every pixel that's bright and opaque as lit,
+// as the Arduboy's white on black screen shows it.
+//
+// Reads greyscale, truecolour and palette images, with or without alpha,
+// as long as they aren't interlaced.
+//
+// Throws 'std::runtime_error' if the file can't be read or isn't such a PNG.
+Bitmap readPng(const std::string & path);
\ No newline at end of file
@@ -0,0 +1,430 @@
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// floorfall-mapc
+//
+// Usage:
+//   floorfall-mapc --pack NAME [--output HEADER] FILE...
+//   floorfall-mapc --raw FILE
+//   floorfall-mapc --level N
+//
+// With '--pack', encodes the maps in each FILE (see 'MapText.h' for the format)
+// and writes a header declaring them as a level pack called 'Levels::NAME'
+// (see 'Levels/LevelPack.h'), in the order given.
+// Each level is solved to find its par, which makes this a little slow,
+// and a level that's unsolvable or too easy (see 'LevelInfo::minimumPar') is an error.
+// A level too big for the solver (see 'LevelInfo::maximumSolvedWidth') goes without a par.
+// The header is written to HEADER, or printed if there isn't one.
+//
+// With '--raw', prints just the bytes of a single encoded map.
+//
+// With '--level', decodes level N of 'Levels::levels' and prints it as a map file,
+// ready to be edited and encoded again.
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Levels/Levels.h"
+
+#include "MapEncoder.h"
+#include "MapSummary.h"
+#include "MapText.h"
+
+#include "Solver.h"
+
+namespace
+{
+	constexpr const char * licence =
+		"//\n"
+		"//  Copyright (C) 2021 Pharap (@Pharap)\n"
+		"//\n"
+		"//  Licensed under the Apache License, Version 2.0 (the \"License\");\n"
+		"//  you may not use this file except in compliance with the License.\n"
+		"//  You may obtain a copy of the License at\n"
+		"//\n"
+		"//       http://www.apache.org/licenses/LICENSE-2.0\n"
+		"//\n"
+		"//  Unless required by applicable law or agreed to in writing, software\n"
+		"//  distributed under the License is distributed on an \"AS IS\" BASIS,\n"
+		"//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
+		"//  See the License for the specific language governing permissions and\n"
+		"//  limitations under the License.\n"
+		"//\n";
+
+	// The number of bytes of map data per line of output.
+	constexpr std::size_t bytesPerLine = 8;
+
+	[[noreturn]] void usage()
+	{
+		std::fprintf(stderr, "usage: floorfall-mapc --pack NAME [--output HEADER] FILE...\n       floorfall-mapc --raw FILE\n       floorfall-mapc --level N\n");
+		std::exit(2);
+	}
+
+	void writeByte(std::ostream & stream, std::uint8_t value)
+	{
+		stream << "0x" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << static_cast<unsigned>(value) << std::dec;
+	}
+
+	void writeRaw(std::ostream & stream, const std::vector<std::uint8_t> & bytes)
+	{
+		for(std::size_t index = 0; index < bytes.size(); ++index)
+		{
+			if(index > 0)
+				stream << ", ";
+
+			writeByte(stream, bytes[index]);
+		}
+
+		stream << '\n';
+	}
+
+	struct PackEntry
+	{
+		// The name of the map file, for error messages.
+		std::string fileName;
+
+		MapDescription map;
+		std::vector<std::uint8_t> bytes;
+		LevelInfo info;
+		std::vector<std::uint8_t> thumbnail;
+	};
+
+	void writeBytes(std::ostream & stream, const std::uint8_t * bytes, std::size_t size)
+	{
+		for(std::size_t index = 0; index < size; index += bytesPerLine)
+		{
+			stream << "\t\t";
+
+			for(std::size_t offset = 0; (offset < bytesPerLine) && ((index + offset) < size); ++offset)
+			{
+				if(offset > 0)
+					stream << ' ';
+
+				writeByte(stream, bytes[index + offset]);
+				stream << ',';
+			}
+
+			stream << '\n';
+		}
+	}
+
+	void writeLowHigh(std::ostream & stream, std::size_t value)
+	{
+		writeByte(stream, static_cast<std::uint8_t>(value & 0xFF));
+		stream << ", ";
+		writeByte(stream, static_cast<std::uint8_t>((value >> 8) & 0xFF));
+		stream << ',';
+	}
+
+	void writePack(std::ostream & stream, const std::vector<PackEntry> & entries, const std::string & name)
+	{
+		const std::size_t indexSize = (LevelPack::headerSize + (entries.size() * LevelPack::offsetSize));
+
+		std::size_t totalSize = indexSize;
+
+		for(const auto & entry : entries)
+			totalSize += entry.bytes.size();
+
+		if((entries.size() > 0xFFFF) || (totalSize > 0xFFFF))
+			throw std::runtime_error("the pack is too big for 16-bit offsets");
+
+		stream << "#pragma once\n\n" << licence << '\n';
+		stream << "// Made by floorfall-mapc, don't edit this by hand.\n\n";
+		stream << "#include <stdint.h>\n#include <avr/pgmspace.h>\n\n#include \"LevelInfo.h\"\n#include \"LevelPackChecks.h\"\n\n";
+		stream << "namespace Levels\n{\n";
+		stream << "\tconstexpr uint16_t " << name << "LevelCount = " << entries.size() << ";\n\n";
+		stream << "\tconstexpr uint8_t " << name << "[] PROGMEM\n\t{\n";
+		stream << "\t\t// Format version\n\t\t" << static_cast<unsigned>(LevelPack::formatVersion) << ",\n\n";
+		stream << "\t\t// Level count\n\t\t";
+		writeLowHigh(stream, entries.size());
+		stream << "\n\n\t\t// Offsets\n";
+
+		std::size_t offset = indexSize;
+
+		for(const auto & entry : entries)
+		{
+			stream << "\t\t";
+			writeLowHigh(stream, offset);
+			stream << '\n';
+			offset += entry.bytes.size();
+		}
+
+		for(std::size_t index = 0; index < entries.size(); ++index)
+		{
+			const auto & entry = entries[index];
+
+			// Keep a picture of each map, since the bytes are unreadable.
+			stream << "\n\t\t// Level " << index << ", player at " << static_cast<unsigned>(entry.map.playerX) << ", " << static_cast<unsigned>(entry.map.playerY) << '\n';
+			writeMapRows(stream, entry.map, "\t\t// ");
+			writeBytes(stream, entry.bytes.data(), entry.bytes.size());
+		}
+
+		stream << "\t};\n\n";
+
+		stream << "\tconstexpr LevelInfo " << name << "Info[] PROGMEM\n\t{\n";
+		stream << "\t\t// Width, height, buttons, broken tiles, par\n";
+
+		for(const auto & entry : entries)
+		{
+			const LevelInfo & info = entry.info;
+
+			stream << "\t\t{ " << static_cast<unsigned>(info.width) << ", " << static_cast<unsigned>(info.height);
+			stream << ", " << static_cast<unsigned>(info.buttonCount) << ", " << static_cast<unsigned>(info.brokenCount) << ", ";
+
+			if(info.par == LevelInfo::noPar)
+				stream << "LevelInfo::noPar";
+			else
+				stream << static_cast<unsigned>(info.par);
+
+			stream << " },\n";
+		}
+
+		stream << "\t};\n\n";
+
+		stream << "\tconstexpr uint8_t " << name << "Thumbnails[] PROGMEM\n\t{\n";
+
+		for(std::size_t index = 0; index < entries.size(); ++index)
+		{
+			if(index > 0)
+				stream << '\n';
+
+			stream << "\t\t// Level " << index << '\n';
+			writeBytes(stream, entries[index].thumbnail.data(), entries[index].thumbnail.size());
+		}
+
+		stream << "\t};\n\n";
+
+		// 'LevelPackChecks::getPackProblem' can only say what's wrong, not where,
+		// so each level is also checked on its own, with an error message that names it.
+		// The checks depend on the board the levels are loaded onto,
+		// so they're left for the game to instantiate.
+		stream << "\t// Checks each level on its own, so that a broken level is named by the error.\n";
+		stream << "\t// 'Checker::getLevelProblem(index, offset)' should check the level\n";
+		stream << "\t// that starts at 'offset' against the board it'll be loaded onto.\n";
+		stream << "\ttemplate<typename Checker>\n";
+		stream << "\tconstexpr bool check" << static_cast<char>(std::toupper(static_cast<unsigned char>(name.front()))) << name.substr(1) << "Levels()\n\t{\n";
+
+		offset = indexSize;
+
+		for(std::size_t index = 0; index < entries.size(); ++index)
+		{
+			stream << "\t\tstatic_assert(Checker::getLevelProblem(" << index << ", 0x" << std::hex << std::uppercase << std::setw(4) << std::setfill('0') << offset << std::dec << ") == LevelPackChecks::Problem::None, ";
+			stream << "\"Level " << index << " (" << entries[index].fileName << ") is broken\");\n";
+			offset += entries[index].bytes.size();
+		}
+
+		stream << "\t\treturn true;\n\t}\n}";
+	}
+
+	// The name of a file without the directories leading to it.
+	std::string getFileName(const std::string & path)
+	{
+		const std::size_t separator = path.find_last_of("/\\");
+
+		return (separator != std::string::npos) ? path.substr(separator + 1) : path;
+	}
+
+	// The game won't compile a pack with either of these problems
+	// (see 'Levels/LevelPackChecks.h'), but here the file can be named.
+	void checkLevel(const MapDescription & map, const LevelInfo & info, const std::string & path)
+	{
+		if(getTileCharacter(map.getTile(map.playerX, map.playerY)) == '.')
+			throw std::runtime_error(path + ": the player starts on an empty tile");
+
+		if(info.buttonCount == 0)
+			throw std::runtime_error(path + ": there are no buttons");
+	}
+
+	// Finds the fewest moves that complete a map,
+	// or 'LevelInfo::noPar' if it's too big to solve.
+	// Throws 'std::runtime_error' if there's no solution,
+	// or if it's too short or too long for the level to be packed.
+	std::uint8_t findPar(const MapDescription & map, const std::vector<std::uint8_t> & bytes, const std::string & path)
+	{
+		if((map.width > LevelInfo::maximumSolvedWidth) || (map.height > LevelInfo::maximumSolvedHeight))
+		{
+			std::fprintf(stderr, "floorfall-mapc: %s is too big to solve, so it has no par\n", path.c_str());
+			return LevelInfo::noPar;
+		}
+
+		const Solver solver { SolverOptions {} };
+		const SolverResult result = solver.solve(bytes.data());
+
+		if(!result.solvable)
+			throw std::runtime_error(path + " is unsolvable");
+
+		if(result.moveCount < LevelInfo::minimumPar)
+			throw std::runtime_error(path + " can be solved in " + std::to_string(result.moveCount) + " moves, which is too easy");
+
+		if(result.moveCount >= LevelInfo::noPar)
+			throw std::runtime_error(path + " takes too many moves to solve");
+
+		return static_cast<std::uint8_t>(result.moveCount);
+	}
+
+	void writeMapFile(std::ostream & stream, const MapDescription & map, std::size_t level)
+	{
+		stream << "// Level " << level << '\n';
+		stream << "player " << static_cast<unsigned>(map.playerX) << ' ' << static_cast<unsigned>(map.playerY) << '\n';
+		writeMapRows(stream, map, "");
+	}
+}
+
+int main(int argumentCount, char * arguments[])
+{
+	std::string packName;
+	std::string outputPath;
+	std::string level;
+	std::vector<std::string> paths;
+	bool raw = false;
+
+	for(int index = 1; index < argumentCount; ++index)
+	{
+		const std::string argument { arguments[index] };
+
+		if(argument == "--raw")
+		{
+			raw = true;
+		}
+		else if((argument == "--pack") || (argument == "--output") || (argument == "--level"))
+		{
+			if((index + 1) >= argumentCount)
+				usage();
+
+			const std::string value { arguments[++index] };
+
+			if(argument == "--pack")
+				packName = value;
+			else if(argument == "--output")
+				outputPath = value;
+			else
+				level = value;
+		}
+		else if(!argument.empty() && (argument[0] != '-'))
+		{
+			paths.push_back(argument);
+		}
+		else
+		{
+			usage();
+		}
+	}
+
+	// Exactly one mode must be chosen.
+	const int modeCount = ((packName.empty() ? 0 : 1) + (raw ? 1 : 0) + (level.empty() ? 0 : 1));
+
+	if(modeCount != 1)
+		usage();
+
+	try
+	{
+		if(!level.empty())
+		{
+			if(!paths.empty() || !outputPath.empty())
+				usage();
+
+			const std::size_t index = std::stoul(level);
+
+			if(index >= Levels::levels.getLevelCount())
+				throw std::runtime_error("there is no level " + level);
+
+			writeMapFile(std::cout, decodeMap(Levels::levels.getLevel(static_cast<std::uint16_t>(index))), index);
+			return 0;
+		}
+
+		std::vector<PackEntry> entries;
+
+		for(const auto & path : paths)
+		{
+			std::ifstream file { path };
+
+			if(!file)
+				throw std::runtime_error("can't open " + path);
+
+			MapDescription map = parseMapText(file, path);
+			std::vector<std::uint8_t> bytes = encodeMap(map);
+
+			if(raw)
+			{
+				entries.push_back(PackEntry { getFileName(path), std::move(map), std::move(bytes), LevelInfo {}, {} });
+				continue;
+			}
+
+			std::vector<std::uint8_t> thumbnail = drawThumbnail(map);
+
+			LevelInfo info = summariseMap(map);
+			checkLevel(map, info, path);
+			info.par = findPar(map, bytes, path);
+
+			entries.push_back(PackEntry { getFileName(path), std::move(map), std::move(bytes), info, std::move(thumbnail) });
+		}
+
+		if(raw)
+		{
+			if((entries.size() != 1) || !outputPath.empty())
+				usage();
+
+			writeRaw(std::cout, entries.front().bytes);
+			return 0;
+		}
+
+		if(entries.empty())
+			usage();
+
+		std::ostringstream header;
+		writePack(header, entries, packName);
+
+		if(outputPath.empty())
+		{
+			std::cout << header.str() << '\n';
+		}
+		else
+		{
+			// The game's sources use Windows line endings,
+			// so the header should too.
+			std::ofstream output { outputPath, std::ios::binary };
+
+			for(const char character : header.str())
+			{
+				if(character == '\n')
+					output << '\r';
+
+				output << character;
+			}
+
+			if(!output)
+				throw std::runtime_error("can't write " + outputPath);
+		}
+	}
+	catch(const std::exception & exception)
+	{
+		std::fprintf(stderr, "floorfall-mapc: %s\n", exception.what());
+		return 2;
+	}
+
+	return 0;
+}
\ No newline at end of file
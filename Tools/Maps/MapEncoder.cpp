@@ -0,0 +1,193 @@
+#include "MapEncoder.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "Logic/MapLoading.h"
+
+namespace
+{
+	// Writes codes most significant bit first, as 'MapTileReader' reads them.
+	class BitWriter
+	{
+	private:
+		std::vector<std::uint8_t> & bytes;
+		std::uint8_t bitsUsed { 8 };
+
+	public:
+		explicit BitWriter(std::vector<std::uint8_t> & bytes) :
+			bytes { bytes }
+		{
+		}
+
+		void write(std::uint8_t value, std::uint8_t bitCount)
+		{
+			for(std::uint8_t index = bitCount; index > 0; --index)
+			{
+				if(this->bitsUsed == 8)
+				{
+					this->bytes.push_back(0);
+					this->bitsUsed = 0;
+				}
+
+				const std::uint8_t bit = ((value >> (index - 1)) & 1);
+				this->bytes.back() |= static_cast<std::uint8_t>(bit << (7 - this->bitsUsed));
+				++this->bitsUsed;
+			}
+		}
+	};
+
+	struct Code
+	{
+		std::uint8_t value;
+		std::uint8_t bitCount;
+	};
+
+	// The code for a tile, with any steps that follow it.
+	Code getCode(Tile tile)
+	{
+		const auto parameter = tile.getParameter();
+
+		switch(tile.getType())
+		{
+			case TileType::Broken:
+				if(parameter == 0)
+					return Code { MapCode::emptyTile, MapCode::emptyTileBits };
+
+				if(parameter == 1)
+					return Code { MapCode::brokenTile, MapCode::brokenTileBits };
+
+				return Code
+				{
+					static_cast<std::uint8_t>((MapCode::steppedTile << MapCode::stepsBits) | parameter),
+					static_cast<std::uint8_t>(MapCode::steppedTileBits + MapCode::stepsBits)
+				};
+
+			case TileType::Solid:
+				return Code { MapCode::solidTile, MapCode::solidTileBits };
+
+			case TileType::Button:
+				if(parameter == 0)
+					return Code { MapCode::offButton, MapCode::offButtonBits };
+
+				if(parameter == 1)
+					return Code { MapCode::onButton, MapCode::onButtonBits };
+
+				break;
+		}
+
+		throw std::runtime_error("a tile can't be encoded");
+	}
+
+	bool isSameTile(Tile left, Tile right)
+	{
+		return ((left.getType() == right.getType()) && (left.getParameter() == right.getParameter()));
+	}
+}
+
+std::vector<std::uint8_t> encodeMap(const MapDescription & map)
+{
+	std::vector<std::uint8_t> bytes { map.width, map.height, map.playerX, map.playerY };
+	BitWriter writer { bytes };
+
+	constexpr std::uint8_t repeatCodeBits = (MapCode::repeatBits + MapCode::repeatCountBits);
+
+	// The reader starts out as though an empty tile came before the map.
+	Tile previous = Tile::makeEmptyTile();
+
+	std::size_t index = 0;
+
+	while(index < map.tiles.size())
+	{
+		const Tile tile = map.tiles[index];
+
+		// Count the copies of the previous tile starting here.
+		std::size_t run = 0;
+
+		while(((index + run) < map.tiles.size()) && isSameTile(map.tiles[index + run], previous))
+			++run;
+
+		const Code code = getCode(tile);
+
+		// A repeat code only pays off if it's shorter than writing the tiles out.
+		if(run >= MapCode::minimumRepeat)
+		{
+			const std::size_t length = std::min<std::size_t>(run, MapCode::maximumRepeat);
+
+			if((length * code.bitCount) > repeatCodeBits)
+			{
+				writer.write(MapCode::repeat, MapCode::repeatBits);
+				writer.write(static_cast<std::uint8_t>(length - MapCode::minimumRepeat), MapCode::repeatCountBits);
+				index += length;
+				continue;
+			}
+		}
+
+		writer.write(code.value, code.bitCount);
+		previous = tile;
+		++index;
+	}
+
+	// Make sure the result reads back the same.
+	const MapDescription decoded = decodeMap(bytes.data());
+
+	for(std::size_t tileIndex = 0; tileIndex < map.tiles.size(); ++tileIndex)
+		if(!isSameTile(decoded.tiles[tileIndex], map.tiles[tileIndex]))
+			throw std::logic_error("the map didn't survive encoding");
+
+	if(readMapSize(bytes.data()) != bytes.size())
+		throw std::logic_error("the encoded map is the wrong size");
+
+	return bytes;
+}
+
+MapDescription decodeMap(const std::uint8_t * map)
+{
+	MapDescription result {};
+	result.width = readMapWidth(map);
+	result.height = readMapHeight(map);
+	result.playerX = readMapPlayerX(map);
+	result.playerY = readMapPlayerY(map);
+
+	// 'loadMapTiles' works with any board, so give it one the size of the map.
+	struct TileList
+	{
+		MapDescription & map;
+
+		std::uint8_t getWidth() const
+		{
+			return this->map.width;
+		}
+
+		std::uint8_t getHeight() const
+		{
+			return this->map.height;
+		}
+
+		void setCell(std::uint8_t, std::uint8_t, Tile tile)
+		{
+			this->map.tiles.push_back(tile);
+		}
+	};
+
+	TileList board { result };
+	loadMapTiles(board, map);
+
+	return result;
+}
\ No newline at end of file
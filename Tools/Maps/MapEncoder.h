@@ -0,0 +1,31 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <cstdint>
+#include <vector>
+
+#include "MapText.h"
+
+// Encodes a map in the format that 'loadMapTiles' reads.
+// (See 'Logic/MapLoading.h'.)
+//
+// Throws 'std::runtime_error' if a tile can't be encoded.
+std::vector<std::uint8_t> encodeMap(const MapDescription & map);
+
+// Decodes a map with 'loadMapTiles', as the game would.
+MapDescription decodeMap(const std::uint8_t * map);
\ No newline at end of file
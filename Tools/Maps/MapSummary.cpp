@@ -0,0 +1,146 @@
+#include "MapSummary.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <algorithm>
+
+namespace
+{
+	// The pixels of each kind of tile, as two 2-bit columns,
+	// least significant bit at the top.
+	struct TilePixels
+	{
+		char character;
+		std::uint8_t left;
+		std::uint8_t right;
+	};
+
+	// Two pixels can't show much, so the aim is just
+	// to tell the kinds of tile apart at a glance:
+	// solid tiles are filled, broken tiles are a checkerboard,
+	// off buttons are a single dot and on buttons are three.
+	constexpr TilePixels tilePixels[]
+	{
+		{ '#', 0x3, 0x3 },
+		{ 'o', 0x1, 0x0 },
+		{ 'O', 0x3, 0x1 },
+	};
+
+	constexpr TilePixels brokenPixels { '1', 0x1, 0x2 };
+
+	TilePixels getTilePixels(Tile tile)
+	{
+		const char character = getTileCharacter(tile);
+
+		if((character >= '1') && (character <= '9'))
+			return brokenPixels;
+
+		for(const auto & pixels : tilePixels)
+			if(pixels.character == character)
+				return pixels;
+
+		// Empty tiles, and anything that can't be encoded anyway.
+		return TilePixels { character, 0x0, 0x0 };
+	}
+
+	// Draws a map that's too big for 2x2 pixels per tile,
+	// with each pixel covering the same number of tiles in both directions.
+	void drawShrunkenThumbnail(std::vector<std::uint8_t> & thumbnail, const MapDescription & map)
+	{
+		const std::size_t largest = std::max<std::size_t>(map.width, map.height);
+		const std::size_t largestThumbnail = std::min<std::size_t>(LevelThumbnail::width, LevelThumbnail::height);
+
+		// The number of tiles along each side of a pixel, rounded up.
+		const std::size_t scale = ((largest + largestThumbnail - 1) / largestThumbnail);
+
+		for(std::size_t pixelY = 0; (pixelY * scale) < map.height; ++pixelY)
+			for(std::size_t pixelX = 0; (pixelX * scale) < map.width; ++pixelX)
+			{
+				bool lit = false;
+
+				for(std::size_t y = (pixelY * scale); (y < ((pixelY + 1) * scale)) && (y < map.height); ++y)
+					for(std::size_t x = (pixelX * scale); (x < ((pixelX + 1) * scale)) && (x < map.width); ++x)
+						lit = (lit || (getTileCharacter(map.getTile(x, y)) != '.'));
+
+				if(lit)
+					thumbnail[((pixelY / 8) * LevelThumbnail::width) + pixelX] |= static_cast<std::uint8_t>(1 << (pixelY % 8));
+			}
+	}
+}
+
+LevelInfo summariseMap(const MapDescription & map)
+{
+	LevelInfo info {};
+
+	info.width = map.width;
+	info.height = map.height;
+	info.par = LevelInfo::noPar;
+
+	for(const Tile tile : map.tiles)
+	{
+		switch(tile.getType())
+		{
+			case TileType::Button:
+				++info.buttonCount;
+				break;
+
+			case TileType::Broken:
+				if(tile.getParameter() > 0)
+					++info.brokenCount;
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	return info;
+}
+
+std::vector<std::uint8_t> drawThumbnail(const MapDescription & map)
+{
+	constexpr std::size_t tilesWide = (LevelThumbnail::width / LevelThumbnail::tileSize);
+	constexpr std::size_t tilesHigh = (LevelThumbnail::height / LevelThumbnail::tileSize);
+
+	// The number of rows of tiles in each page of the thumbnail.
+	constexpr std::size_t tilesPerPage = (8 / LevelThumbnail::tileSize);
+
+	std::vector<std::uint8_t> thumbnail(LevelThumbnail::size, 0);
+
+	if((map.width > tilesWide) || (map.height > tilesHigh))
+	{
+		drawShrunkenThumbnail(thumbnail, map);
+		return thumbnail;
+	}
+
+	for(std::size_t y = 0; y < map.height; ++y)
+	{
+		const std::size_t page = (y / tilesPerPage);
+		const std::size_t shift = ((y % tilesPerPage) * LevelThumbnail::tileSize);
+
+		for(std::size_t x = 0; x < map.width; ++x)
+		{
+			const TilePixels pixels = getTilePixels(map.getTile(x, y));
+			const std::size_t column = ((page * LevelThumbnail::width) + (x * LevelThumbnail::tileSize));
+
+			thumbnail[column + 0] |= static_cast<std::uint8_t>(pixels.left << shift);
+			thumbnail[column + 1] |= static_cast<std::uint8_t>(pixels.right << shift);
+		}
+	}
+
+	return thumbnail;
+}
\ No newline at end of file
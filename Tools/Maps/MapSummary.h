@@ -0,0 +1,33 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <cstdint>
+#include <vector>
+
+#include "Levels/LevelInfo.h"
+
+#include "MapText.h"
+
+// Works out the 'LevelInfo' of a map, apart from its par,
+// which is left as 'LevelInfo::noPar'.
+LevelInfo summariseMap(const MapDescription & map);
+
+// Draws the thumbnail of a map, in the format described in 'Levels/LevelInfo.h'.
+// A map too big for 2x2 pixels per tile is shrunk to fit instead,
+// with each pixel lit if any of the tiles it covers isn't empty.
+std::vector<std::uint8_t> drawThumbnail(const MapDescription & map);
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "MapText.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+	bool isSameTile(Tile left, Tile right)
+	{
+		return ((left.getType() == right.getType()) && (left.getParameter() == right.getParameter()));
+	}
+
+	bool parseTile(char character, Tile & tile)
+	{
+		switch(character)
+		{
+			case '.':
+				tile = Tile::makeEmptyTile();
+				return true;
+
+			case '#':
+				tile = Tile::makeSolidTile();
+				return true;
+
+			case 'o':
+				tile = Tile::makeOffButton();
+				return true;
+
+			case 'O':
+				tile = Tile::makeOnButton();
+				return true;
+
+			default:
+				// One digit is as many steps as the game can draw.
+				static_assert(Tile::maximumSteps == 9, "Map files can only give a broken tile up to 9 steps");
+
+				if((character >= '1') && (character <= '9'))
+				{
+					tile = Tile::makeBrokenTile(static_cast<std::uint8_t>(character - '0'));
+					return true;
+				}
+
+				return false;
+		}
+	}
+
+	std::string trim(const std::string & text)
+	{
+		const auto first = text.find_first_not_of(" \t\r");
+
+		if(first == std::string::npos)
+			return std::string();
+
+		const auto last = text.find_last_not_of(" \t\r");
+
+		return text.substr(first, (last - first) + 1);
+	}
+}
+
+char getTileCharacter(Tile tile)
+{
+	for(const char character : std::string(".#oO123456789"))
+	{
+		Tile candidate {};
+
+		if(parseTile(character, candidate) && isSameTile(candidate, tile))
+			return character;
+	}
+
+	return '?';
+}
+
+MapDescription parseMapText(std::istream & stream, const std::string & name)
+{
+	MapDescription map {};
+
+	bool playerGiven = false;
+	std::size_t lineNumber = 0;
+	std::string line;
+
+	const auto fail = [&](const std::string & message)
+	{
+		throw std::runtime_error(name + ":" + std::to_string(lineNumber) + ": " + message);
+	};
+
+	while(std::getline(stream, line))
+	{
+		++lineNumber;
+
+		const auto comment = line.find("//");
+
+		if(comment != std::string::npos)
+			line.erase(comment);
+
+		line = trim(line);
+
+		if(line.empty())
+			continue;
+
+		if(line.compare(0, 6, "player") == 0)
+		{
+			std::istringstream words { line.substr(6) };
+			unsigned x = 0;
+			unsigned y = 0;
+
+			if(!(words >> x >> y) || playerGiven)
+				fail("expected a single 'player X Y'");
+
+			map.playerX = static_cast<std::uint8_t>(x);
+			map.playerY = static_cast<std::uint8_t>(y);
+			playerGiven = true;
+			continue;
+		}
+
+		if(map.height == 0)
+		{
+			if(line.size() > 255)
+				fail("the map is too wide");
+
+			map.width = static_cast<std::uint8_t>(line.size());
+		}
+		else if(line.size() != map.width)
+		{
+			fail("every row must be " + std::to_string(map.width) + " tiles wide");
+		}
+
+		if(map.height == 255)
+			fail("the map is too tall");
+
+		for(const char character : line)
+		{
+			Tile tile {};
+
+			if(!parseTile(character, tile))
+				fail(std::string("'") + character + "' isn't a tile");
+
+			map.tiles.push_back(tile);
+		}
+
+		++map.height;
+	}
+
+	if(map.height == 0)
+		fail("there are no rows");
+
+	if(!playerGiven)
+		fail("there's no 'player X Y' line");
+
+	if((map.playerX >= map.width) || (map.playerY >= map.height))
+		fail("the player is outside of the map");
+
+	return map;
+}
+
+void writeMapRows(std::ostream & stream, const MapDescription & map, const std::string & prefix)
+{
+	for(std::size_t y = 0; y < map.height; ++y)
+	{
+		stream << prefix;
+
+		for(std::size_t x = 0; x < map.width; ++x)
+			stream << getTileCharacter(map.getTile(x, y));
+
+		stream << '\n';
+	}
+}
\ No newline at end of file
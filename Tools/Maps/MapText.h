@@ -0,0 +1,74 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <cstdint>
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Logic/Tile.h"
+
+// A map as a grid of tiles, before it's encoded for progmem.
+struct MapDescription
+{
+	std::uint8_t width { 0 };
+	std::uint8_t height { 0 };
+
+	std::uint8_t playerX { 0 };
+	std::uint8_t playerY { 0 };
+
+	// Row by row, 'width' tiles to a row.
+	std::vector<Tile> tiles {};
+
+	Tile getTile(std::size_t x, std::size_t y) const
+	{
+		return this->tiles[(y * this->width) + x];
+	}
+};
+
+// Maps are written as text, one line per row of tiles:
+//   .     An empty tile
+//   1-9   A broken tile with that many steps left
+//   #     A solid tile
+//   o     An off button
+//   O     An on button
+//
+// A 'player X Y' line gives the player's starting position,
+// blank lines are ignored and '//' starts a comment.
+// For example:
+//
+//   // Level 5
+//   player 0 4
+//   o1o
+//   1.1
+//   O1o
+//   2..
+//   o..
+//
+// Throws 'std::runtime_error' if the text isn't a valid map.
+MapDescription parseMapText(std::istream & stream, const std::string & name);
+
+// Writes a map in the same format that 'parseMapText' reads,
+// except for the 'player' line.
+void writeMapRows(std::ostream & stream, const MapDescription & map, const std::string & prefix);
+
+// Gets the character that stands for a tile,
+// or '?' if there isn't one.
+char getTileCharacter(Tile tile);
\ No newline at end of file
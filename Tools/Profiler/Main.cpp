@@ -0,0 +1,252 @@
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// floorfall-profiler
+//
+// Usage:
+//   floorfall-profiler [--frames N] [--script FILE] FIRMWARE.elf
+//
+// Runs a build of the game made with FLOORFALL_PROFILE defined
+// on a simulated ATmega32U4, pressing the buttons listed in the script
+// (see 'Host/Headless/InputScript.h') one frame at a time.
+// It stops after N frames (by default the length of the script),
+// then reports the cycles spent in each 'ProfileSection'
+// and the worst frame against the 60 frames per second budget.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+
+#include <sim_avr.h>
+#include <sim_elf.h>
+#include <avr_ioport.h>
+
+// For the button masks
+#include <Arduboy2.h>
+
+#include "InputScript.h"
+
+#include "Profile.h"
+
+namespace
+{
+	// GPIOR0, as a data space address.
+	constexpr avr_io_addr_t markerAddress = 0x3E;
+
+	// PLLCSR, as a data space address, and its lock bit.
+	constexpr avr_io_addr_t pllControlAddress = 0x49;
+	constexpr std::uint8_t pllLockBit = 0x01;
+
+	// Give up if this many simulated seconds pass without a mark.
+	constexpr std::uint64_t markTimeout = (Profile::clockRate * 10);
+
+	// Where the Arduboy's buttons are wired.
+	// They're active low, so a pin is pulled to 0 while its button is held.
+	struct ButtonPin
+	{
+		std::uint8_t button;
+		char port;
+		std::uint8_t pin;
+	};
+
+	constexpr ButtonPin buttonPins[]
+	{
+		{ LEFT_BUTTON, 'F', 5 },
+		{ RIGHT_BUTTON, 'F', 6 },
+		{ UP_BUTTON, 'F', 7 },
+		{ DOWN_BUTTON, 'F', 4 },
+		{ A_BUTTON, 'E', 6 },
+		{ B_BUTTON, 'B', 4 },
+	};
+
+	struct Session
+	{
+		avr_t * avr;
+		Profile profile;
+		InputScript script;
+		std::uint64_t frameLimit;
+		std::uint64_t lastMark;
+		bool finished;
+		bool badMark;
+	};
+
+	[[noreturn]] void usage()
+	{
+		std::fprintf(stderr, "usage: floorfall-profiler [--frames N] [--script FILE] FIRMWARE.elf\n");
+		std::exit(2);
+	}
+
+	void setButtons(avr_t * avr, std::uint8_t buttons)
+	{
+		for(const auto & buttonPin : buttonPins)
+		{
+			avr_irq_t * irq = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(buttonPin.port), buttonPin.pin);
+			avr_raise_irq(irq, ((buttons & buttonPin.button) != 0) ? 0 : 1);
+		}
+	}
+
+	// Called whenever the game writes to GPIOR0.
+	void onMark(avr_t * avr, avr_io_addr_t address, std::uint8_t value, void * parameter)
+	{
+		auto & session = *static_cast<Session *>(parameter);
+
+		// Keep the register behaving like a register.
+		avr->data[address] = value;
+
+		session.lastMark = avr->cycle;
+
+		if(Profile::getSectionName(value) == nullptr)
+		{
+			session.badMark = true;
+			return;
+		}
+
+		if(!session.profile.enter(value, avr->cycle))
+			return;
+
+		// A new frame has begun, and it hasn't polled the buttons yet,
+		// so this is the moment to change them.
+		const std::uint64_t frame = session.profile.getFrameCount();
+
+		if(frame >= session.frameLimit)
+		{
+			session.finished = true;
+			return;
+		}
+
+		setButtons(avr, session.script.getButtons(frame));
+	}
+
+	// The Arduino core waits for the USB PLL to lock before going any further,
+	// so make sure it always reads as locked.
+	std::uint8_t onPllRead(avr_t * avr, avr_io_addr_t address, void *)
+	{
+		return static_cast<std::uint8_t>(avr->data[address] | pllLockBit);
+	}
+}
+
+int main(int argumentCount, char * arguments[])
+{
+	Session session {};
+	std::string firmwarePath;
+	bool frameLimitGiven = false;
+
+	try
+	{
+		for(int index = 1; index < argumentCount; ++index)
+		{
+			const std::string argument { arguments[index] };
+
+			if((argument == "--frames") || (argument == "--script"))
+			{
+				if((index + 1) >= argumentCount)
+					usage();
+
+				const std::string value { arguments[++index] };
+
+				if(argument == "--frames")
+				{
+					session.frameLimit = std::stoull(value);
+					frameLimitGiven = true;
+				}
+				else
+				{
+					session.script = InputScript::load(value);
+				}
+			}
+			else if(!argument.empty() && (argument[0] != '-') && firmwarePath.empty())
+			{
+				firmwarePath = argument;
+			}
+			else
+			{
+				usage();
+			}
+		}
+	}
+	catch(const std::exception & exception)
+	{
+		std::fprintf(stderr, "floorfall-profiler: %s\n", exception.what());
+		return 2;
+	}
+
+	if(firmwarePath.empty())
+		usage();
+
+	if(!frameLimitGiven)
+		session.frameLimit = session.script.isEmpty() ? 600 : session.script.getFrameCount();
+
+	elf_firmware_t firmware {};
+
+	if(elf_read_firmware(firmwarePath.c_str(), &firmware) != 0)
+	{
+		std::fprintf(stderr, "floorfall-profiler: can't load %s\n", firmwarePath.c_str());
+		return 2;
+	}
+
+	avr_t * avr = avr_make_mcu_by_name("atmega32u4");
+
+	if(avr == nullptr)
+	{
+		std::fprintf(stderr, "floorfall-profiler: this simavr doesn't support the atmega32u4\n");
+		return 2;
+	}
+
+	avr_init(avr);
+	avr_load_firmware(avr, &firmware);
+	avr->frequency = Profile::clockRate;
+
+	session.avr = avr;
+
+	avr_register_io_write(avr, markerAddress, onMark, &session);
+	avr_register_io_read(avr, pllControlAddress, onPllRead, nullptr);
+
+	// Nothing is pressed to begin with.
+	setButtons(avr, 0);
+
+	while(!session.finished && !session.badMark)
+	{
+		const int state = avr_run(avr);
+
+		if((state == cpu_Done) || (state == cpu_Crashed))
+		{
+			std::fprintf(stderr, "floorfall-profiler: the simulated CPU stopped after %llu frames\n",
+				static_cast<unsigned long long>(session.profile.getFrameCount()));
+			return 1;
+		}
+
+		if((avr->cycle - session.lastMark) > markTimeout)
+		{
+			std::fprintf(stderr, "floorfall-profiler: no marks for %llu cycles, was the firmware built with FLOORFALL_PROFILE?\n",
+				static_cast<unsigned long long>(markTimeout));
+			return 1;
+		}
+	}
+
+	if(session.badMark)
+	{
+		std::fprintf(stderr, "floorfall-profiler: the firmware marked a section that doesn't exist\n");
+		return 1;
+	}
+
+	session.profile.report(stdout);
+
+	avr_terminate(avr);
+
+	return 0;
+}
\ No newline at end of file
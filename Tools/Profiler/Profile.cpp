@@ -0,0 +1,167 @@
+#include "Profile.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+namespace
+{
+	// In the same order as 'ProfileSection'.
+	constexpr const char * sectionNames[]
+	{
+		"Idle",
+		"Frame",
+		"SplashscreenUpdate",
+		"SplashscreenRender",
+		"TitlescreenUpdate",
+		"TitlescreenRender",
+		"LevelSelectUpdate",
+		"LevelSelectRender",
+		"GameplayUpdate",
+		"GameplayRender",
+		"HintSearch",
+	};
+
+	static_assert((sizeof(sectionNames) / sizeof(sectionNames[0])) == profileSectionCount, "sectionNames doesn't match ProfileSection");
+
+	constexpr std::uint8_t idleSection = static_cast<std::uint8_t>(ProfileSection::Idle);
+	constexpr std::uint8_t frameSection = static_cast<std::uint8_t>(ProfileSection::Frame);
+
+	double toMilliseconds(std::uint64_t cycles)
+	{
+		return ((cycles * 1000.0) / Profile::clockRate);
+	}
+
+	double toBudgetPercentage(std::uint64_t cycles)
+	{
+		return ((cycles * 100.0) / Profile::frameBudget);
+	}
+}
+
+const char * Profile::getSectionName(std::uint8_t section)
+{
+	return (section < profileSectionCount) ? sectionNames[section] : nullptr;
+}
+
+bool Profile::enter(std::uint8_t section, std::uint64_t cycle)
+{
+	// Charge the time since the last mark to the last section.
+	if(this->currentSection == noSection)
+		this->startupCycles = cycle;
+	else if(this->inFrame)
+		this->sections[this->currentSection].frameCycles += (cycle - this->sectionStart);
+
+	bool frameBegan = false;
+
+	if(section == idleSection)
+	{
+		if(this->inFrame)
+			this->endFrame(cycle);
+	}
+	else if(!this->inFrame && (section == frameSection))
+	{
+		this->inFrame = true;
+		this->frameStart = cycle;
+		frameBegan = true;
+	}
+
+	this->currentSection = section;
+	this->sectionStart = cycle;
+
+	return frameBegan;
+}
+
+void Profile::endFrame(std::uint64_t cycle)
+{
+	this->inFrame = false;
+
+	const std::uint64_t frameCycles = (cycle - this->frameStart);
+
+	std::uint8_t worstSection = noSection;
+	std::uint64_t worstSectionCycles = 0;
+
+	for(std::uint8_t index = 0; index < profileSectionCount; ++index)
+	{
+		auto & stats = this->sections[index];
+
+		if(stats.frameCycles == 0)
+			continue;
+
+		++stats.frames;
+		stats.totalCycles += stats.frameCycles;
+
+		if(stats.frameCycles > stats.worstCycles)
+			stats.worstCycles = stats.frameCycles;
+
+		if(stats.frameCycles > worstSectionCycles)
+		{
+			worstSection = index;
+			worstSectionCycles = stats.frameCycles;
+		}
+
+		stats.frameCycles = 0;
+	}
+
+	if(frameCycles > frameBudget)
+		++this->overBudgetFrames;
+
+	if(frameCycles > this->worstFrameCycles)
+	{
+		this->worstFrameCycles = frameCycles;
+		this->worstFrameIndex = this->frameCount;
+		this->worstFrameSection = worstSection;
+	}
+
+	++this->frameCount;
+}
+
+void Profile::report(std::FILE * file) const
+{
+	std::fprintf(file, "start-up: %llu cycles (%.2f ms)\n",
+		static_cast<unsigned long long>(this->startupCycles), toMilliseconds(this->startupCycles));
+
+	std::fprintf(file, "frames: %llu, budget %llu cycles (%.2f ms) per frame\n\n",
+		static_cast<unsigned long long>(this->frameCount), static_cast<unsigned long long>(frameBudget), toMilliseconds(frameBudget));
+
+	std::fprintf(file, "%-20s %8s %12s %12s %8s\n", "section", "frames", "average", "worst", "worst %");
+
+	for(std::uint8_t index = 0; index < profileSectionCount; ++index)
+	{
+		const auto & stats = this->sections[index];
+
+		if(stats.frames == 0)
+			continue;
+
+		const std::uint64_t average = (stats.totalCycles / stats.frames);
+
+		std::fprintf(file, "%-20s %8llu %12llu %12llu %7.1f%%\n", sectionNames[index],
+			static_cast<unsigned long long>(stats.frames),
+			static_cast<unsigned long long>(average),
+			static_cast<unsigned long long>(stats.worstCycles),
+			toBudgetPercentage(stats.worstCycles));
+	}
+
+	if(this->frameCount == 0)
+		return;
+
+	std::fprintf(file, "\nworst frame: #%llu, %llu cycles (%.2f ms, %.1f%% of budget), mostly %s\n",
+		static_cast<unsigned long long>(this->worstFrameIndex),
+		static_cast<unsigned long long>(this->worstFrameCycles),
+		toMilliseconds(this->worstFrameCycles),
+		toBudgetPercentage(this->worstFrameCycles),
+		(this->worstFrameSection != noSection) ? sectionNames[this->worstFrameSection] : "nothing");
+
+	std::fprintf(file, "frames over budget: %llu\n", static_cast<unsigned long long>(this->overBudgetFrames));
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+#include "Profiling/ProfileSection.h"
+
+// Adds up the cycles spent in each 'ProfileSection'.
+//
+// 'enter' is called with the simulator's cycle count each time the game
+// marks the start of a section, and the cycles since the previous mark
+// are charged to the previous section.
+//
+// A frame runs from entering 'ProfileSection::Frame' after 'ProfileSection::Idle'
+// until entering 'ProfileSection::Idle' again.
+// Anything before the first frame (the boot logo and so on) counts as start-up.
+class Profile
+{
+public:
+	// The CPU clock of an Arduboy.
+	static constexpr std::uint64_t clockRate = 16000000;
+
+	// The cycles available each frame at 60 frames per second.
+	static constexpr std::uint64_t frameBudget = (clockRate / 60);
+
+private:
+	static constexpr std::uint8_t noSection = 0xFF;
+
+	struct SectionStats
+	{
+		// The number of frames in which the section ran at all.
+		std::uint64_t frames { 0 };
+
+		// The total cycles over all of those frames.
+		std::uint64_t totalCycles { 0 };
+
+		// The most cycles spent in the section in one frame.
+		std::uint64_t worstCycles { 0 };
+
+		// The cycles spent in the section so far this frame.
+		std::uint64_t frameCycles { 0 };
+	};
+
+private:
+	SectionStats sections[profileSectionCount] {};
+
+	std::uint8_t currentSection { noSection };
+	std::uint64_t sectionStart { 0 };
+
+	bool inFrame { false };
+	std::uint64_t frameStart { 0 };
+	std::uint64_t frameCount { 0 };
+	std::uint64_t startupCycles { 0 };
+
+	std::uint64_t overBudgetFrames { 0 };
+	std::uint64_t worstFrameCycles { 0 };
+	std::uint64_t worstFrameIndex { 0 };
+
+	// The most expensive section of the worst frame.
+	std::uint8_t worstFrameSection { noSection };
+
+public:
+	// Returns the name of a section,
+	// or nullptr if the value isn't a section.
+	static const char * getSectionName(std::uint8_t section);
+
+	// Records entering a section at the given cycle.
+	// Returns true if this began a new frame.
+	bool enter(std::uint8_t section, std::uint64_t cycle);
+
+	// The number of complete frames so far.
+	std::uint64_t getFrameCount() const
+	{
+		return this->frameCount;
+	}
+
+	void report(std::FILE * file) const;
+
+private:
+	void endFrame(std::uint64_t cycle);
+};
\ No newline at end of file
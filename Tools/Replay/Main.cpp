@@ -0,0 +1,216 @@
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// floorfall-replay
+//
+// Usage:
+//   floorfall-replay FILE...
+//   floorfall-replay --encode LEVEL MOVES --output FILE
+//
+// Prints the level each replay (see 'Logic/Replay.h') was recorded on,
+// whether that level still starts the same way, and its moves,
+// written the same way as 'floorfall-solver' writes solutions:
+// one of 'L', 'R', 'U' and 'D' per move.
+//
+// With '--encode', makes a replay of MOVES on level LEVEL of 'Levels::levels',
+// so that a solution can be played back on the game.
+//
+// Exits with status 1 if any replay is for a level that has changed.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Levels/Levels.h"
+#include "Logic/Grid.h"
+#include "Logic/MapLoading.h"
+#include "Logic/Replay.h"
+#include "Logic/Tile.h"
+
+namespace
+{
+	// Big enough for any map, since only the map is hashed.
+	using Board = Grid<Tile, 0xFF, 0xFF>;
+
+	// In the same order as 'Direction'.
+	constexpr char directionCharacters[] { 'L', 'R', 'U', 'D' };
+
+	[[noreturn]] void usage()
+	{
+		std::fprintf(stderr, "usage: floorfall-replay FILE...\n       floorfall-replay --encode LEVEL MOVES --output FILE\n");
+		std::exit(2);
+	}
+
+	// Hashes the board that a level starts with.
+	std::uint16_t hashLevel(std::uint16_t index)
+	{
+		const std::uint8_t * map = Levels::levels.getLevel(index);
+
+		// The board is far too big to go on the stack.
+		const auto board = std::make_unique<Board>();
+		loadMapTiles(*board, map);
+
+		return hashBoard(*board, readMapWidth(map), readMapHeight(map), readMapPlayerX(map), readMapPlayerY(map));
+	}
+
+	Direction parseDirection(char character)
+	{
+		for(std::size_t index = 0; index < sizeof(directionCharacters); ++index)
+			if(directionCharacters[index] == character)
+				return static_cast<Direction>(index);
+
+		throw std::runtime_error(std::string("'") + character + "' isn't a move");
+	}
+
+	std::uint16_t parseLevel(const std::string & text)
+	{
+		const std::size_t index = std::stoul(text);
+
+		if(index >= Levels::levels.getLevelCount())
+			throw std::runtime_error("there is no level " + text);
+
+		return static_cast<std::uint16_t>(index);
+	}
+
+	// Returns true if the replay matches its level.
+	bool decode(const std::string & path)
+	{
+		std::ifstream file { path, std::ios::binary };
+
+		if(!file)
+			throw std::runtime_error("can't open " + path);
+
+		const std::vector<std::uint8_t> bytes { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+		Replay replay {};
+
+		if(!replay.load(bytes.data(), bytes.size()))
+			throw std::runtime_error(path + " isn't a replay");
+
+		const std::uint16_t level = replay.getLevelIndex();
+
+		const bool exists = (level < Levels::levels.getLevelCount());
+		const bool matches = (exists && (hashLevel(level) == replay.getBoardHash()));
+
+		std::string moves;
+
+		for(std::uint8_t index = 0; index < replay.getMoveCount(); ++index)
+			moves += directionCharacters[static_cast<std::uint8_t>(replay.getMove(index))];
+
+		const char * status = matches ? "" : exists ? " (the level has changed since)" : " (the level no longer exists)";
+
+		std::printf("%s: level %u%s, %u moves: %s\n", path.c_str(), static_cast<unsigned>(level), status,
+			static_cast<unsigned>(replay.getMoveCount()), moves.c_str());
+
+		return matches;
+	}
+
+	void encode(const std::string & levelText, const std::string & moves, const std::string & path)
+	{
+		const std::uint16_t level = parseLevel(levelText);
+
+		if(moves.size() > Replay::capacity)
+			throw std::runtime_error("a replay can't hold more than " + std::to_string(Replay::capacity) + " moves");
+
+		Replay replay {};
+		replay.begin(level, hashLevel(level));
+
+		for(const char character : moves)
+			replay.record(parseDirection(character));
+
+		std::ofstream file { path, std::ios::binary };
+
+		if(!file)
+			throw std::runtime_error("can't create " + path);
+
+		for(std::uint8_t index = 0; index < replay.getSize(); ++index)
+			file.put(static_cast<char>(replay.getByte(index)));
+
+		if(!file)
+			throw std::runtime_error("can't write " + path);
+	}
+}
+
+int main(int argumentCount, char * arguments[])
+{
+	std::vector<std::string> paths;
+	std::string encodeLevel;
+	std::string encodeMoves;
+	std::string outputPath;
+	bool encoding = false;
+
+	for(int index = 1; index < argumentCount; ++index)
+	{
+		const std::string argument { arguments[index] };
+
+		if(argument == "--encode")
+		{
+			if((index + 2) >= argumentCount)
+				usage();
+
+			encoding = true;
+			encodeLevel = arguments[++index];
+			encodeMoves = arguments[++index];
+		}
+		else if(argument == "--output")
+		{
+			if((index + 1) >= argumentCount)
+				usage();
+
+			outputPath = arguments[++index];
+		}
+		else if(!argument.empty() && (argument[0] != '-'))
+		{
+			paths.push_back(argument);
+		}
+		else
+		{
+			usage();
+		}
+	}
+
+	if(encoding ? (outputPath.empty() || !paths.empty()) : (paths.empty() || !outputPath.empty()))
+		usage();
+
+	try
+	{
+		if(encoding)
+		{
+			encode(encodeLevel, encodeMoves, outputPath);
+			return 0;
+		}
+
+		bool allMatch = true;
+
+		for(const auto & path : paths)
+			if(!decode(path))
+				allMatch = false;
+
+		return allMatch ? 0 : 1;
+	}
+	catch(const std::exception & exception)
+	{
+		std::fprintf(stderr, "floorfall-replay: %s\n", exception.what());
+		return 2;
+	}
+}
\ No newline at end of file
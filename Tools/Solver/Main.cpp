@@ -0,0 +1,225 @@
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// floorfall-solver
+//
+// Usage:
+//   floorfall-solver [--threads N] [--table-bits B] [--file MAP]... [LEVEL]...
+//   floorfall-solver [--threads N] [--table-bits B] --check
+//
+// Solves each LEVEL (an index into 'Levels::levels') and each MAP file.
+// With neither, every level in 'Levels::levels' is solved.
+//
+// A map file is written as text, as described in 'Tools/Maps/MapText.h'.
+//
+// With '--check', every level is solved and its shortest solution
+// must also match the par recorded in its 'LevelInfo' and be no shorter
+// than 'LevelInfo::minimumPar'. The build runs this whenever the levels change.
+// Levels too big for the solver are skipped, and have no par to check.
+//
+// Exits with status 1 if any map is unsolvable or fails the check.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Levels/Levels.h"
+#include "Logic/MapLoading.h"
+
+#include "MapEncoder.h"
+#include "MapText.h"
+
+#include "Solver.h"
+
+namespace
+{
+	struct Job
+	{
+		std::string name;
+		std::vector<std::uint8_t> map;
+
+		// The par recorded for the map, if it's a level.
+		std::uint8_t par { LevelInfo::noPar };
+	};
+
+	[[noreturn]] void usage()
+	{
+		std::fprintf(stderr, "usage: floorfall-solver [--threads N] [--table-bits B] [--file MAP]... [LEVEL]...\n       floorfall-solver [--threads N] [--table-bits B] --check\n");
+		std::exit(2);
+	}
+
+	std::vector<std::uint8_t> copyLevel(std::size_t index)
+	{
+		const auto map = Levels::levels.getLevel(static_cast<std::uint16_t>(index));
+
+		return std::vector<std::uint8_t>(map, map + readMapSize(map));
+	}
+
+	Job makeLevelJob(std::size_t level)
+	{
+		const auto index = static_cast<std::uint16_t>(level);
+
+		return Job { "level" + std::to_string(level), copyLevel(level), Levels::levels.getLevelInfo(index).par };
+	}
+
+	// Checks a level's solution against its 'LevelInfo'.
+	// Returns nullptr if it passes, or what's wrong if not.
+	const char * checkPar(const SolverResult & result, std::uint8_t par)
+	{
+		if(!result.solvable)
+			return "it's unsolvable";
+
+		if(result.moveCount < LevelInfo::minimumPar)
+			return "it's too easy";
+
+		if(result.moveCount != par)
+			return "its par is out of date, rebuild the 'levels' target";
+
+		return nullptr;
+	}
+
+	std::vector<std::uint8_t> readMapFile(const std::string & path)
+	{
+		std::ifstream file { path };
+
+		if(!file)
+			throw std::runtime_error("can't open " + path);
+
+		const MapDescription map = parseMapText(file, path);
+
+		if((map.width > BitBoard::width) || (map.height > BitBoard::height))
+			throw std::runtime_error(path + " is too big for the board");
+
+		return encodeMap(map);
+	}
+}
+
+int main(int argumentCount, char * arguments[])
+{
+	SolverOptions options {};
+	std::vector<Job> jobs;
+	bool check = false;
+
+	try
+	{
+		for(int index = 1; index < argumentCount; ++index)
+		{
+			const std::string argument { arguments[index] };
+
+			if((argument == "--threads") || (argument == "--table-bits") || (argument == "--file"))
+			{
+				if((index + 1) >= argumentCount)
+					usage();
+
+				const std::string value { arguments[++index] };
+
+				if(argument == "--threads")
+					options.threadCount = static_cast<unsigned>(std::stoul(value));
+				else if(argument == "--table-bits")
+					options.tableBits = static_cast<unsigned>(std::stoul(value));
+				else
+					jobs.push_back(Job { value, readMapFile(value) });
+			}
+			else if(argument == "--check")
+			{
+				check = true;
+			}
+			else if(!argument.empty() && (argument[0] != '-'))
+			{
+				const std::size_t level = std::stoul(argument);
+
+				if(level >= Levels::levels.getLevelCount())
+					throw std::runtime_error("there is no level " + argument);
+
+				jobs.push_back(makeLevelJob(level));
+			}
+			else
+			{
+				usage();
+			}
+		}
+	}
+	catch(const std::exception & exception)
+	{
+		std::fprintf(stderr, "floorfall-solver: %s\n", exception.what());
+		return 2;
+	}
+
+	// Only the levels have a par to check.
+	if(check && !jobs.empty())
+		usage();
+
+	if(jobs.empty())
+		for(std::size_t level = 0; level < Levels::levels.getLevelCount(); ++level)
+			jobs.push_back(makeLevelJob(level));
+
+	const Solver solver { options };
+
+	bool allPassed = true;
+
+	for(const auto & job : jobs)
+	{
+		if(check && ((readMapWidth(job.map.data()) > LevelInfo::maximumSolvedWidth) || (readMapHeight(job.map.data()) > LevelInfo::maximumSolvedHeight)))
+		{
+			std::printf("%s: too big to solve, skipped\n", job.name.c_str());
+			continue;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		SolverResult result;
+
+		try
+		{
+			result = solver.solve(job.map.data());
+		}
+		catch(const std::exception & exception)
+		{
+			std::fprintf(stderr, "floorfall-solver: %s: %s\n", job.name.c_str(), exception.what());
+			return 2;
+		}
+
+		const std::chrono::duration<double> elapsed = (std::chrono::steady_clock::now() - start);
+
+		if(result.solvable)
+			std::printf("%s: solvable in %zu moves: %s", job.name.c_str(), result.moveCount, result.moves.c_str());
+		else
+			std::printf("%s: unsolvable", job.name.c_str());
+
+		std::printf(" (%zu states, %.3fs)\n", result.stateCount, elapsed.count());
+
+		allPassed = (allPassed && result.solvable);
+
+		if(!check)
+			continue;
+
+		const char * failure = checkPar(result, job.par);
+
+		if(failure != nullptr)
+		{
+			std::fprintf(stderr, "floorfall-solver: %s: %s\n", job.name.c_str(), failure);
+			allPassed = false;
+		}
+	}
+
+	return allPassed ? 0 : 1;
+}
\ No newline at end of file
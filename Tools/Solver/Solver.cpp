@@ -0,0 +1,341 @@
+#include "Solver.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Logic/MapLoading.h"
+
+#include "TranspositionTable.h"
+#include "Zobrist.h"
+
+// Just a shorter name.
+using State = Solver::State;
+
+namespace
+{
+	struct Direction
+	{
+		char name;
+		std::int8_t x;
+		std::int8_t y;
+	};
+
+	// The same four moves that 'GameplayState::updatePlayer' allows.
+	constexpr Direction directions[]
+	{
+		{ 'L', -1, 0 },
+		{ 'R', 1, 0 },
+		{ 'U', 0, -1 },
+		{ 'D', 0, 1 },
+	};
+
+	// Records how a state was reached from the previous layer.
+	struct Link
+	{
+		std::uint32_t parent;
+		std::uint8_t direction;
+	};
+
+	// The output of expanding one chunk of a layer.
+	// Chunks are merged in order, so a single-threaded run is deterministic.
+	struct ChunkOutput
+	{
+		std::vector<State> states;
+		std::vector<Link> links;
+
+		// The lowest estimate cut off by the bound, or zero if none were.
+		std::size_t nextBound { 0 };
+	};
+
+	// The number of frontier states handed to a thread at a time.
+	constexpr std::size_t chunkSize = 1024;
+
+	// The size of the first transposition table tried.
+	constexpr unsigned initialTableBits = 16;
+
+	const Zobrist zobrist {};
+}
+
+Solver::Solver(SolverOptions options) :
+	options { options }
+{
+	if(this->options.threadCount == 0)
+		this->options.threadCount = std::max(1u, std::thread::hardware_concurrency());
+}
+
+SolverResult Solver::solve(const std::uint8_t * map) const
+{
+	SolverResult result {};
+
+	if((readMapWidth(map) > BitBoard::width) || (readMapHeight(map) > BitBoard::height))
+		throw std::runtime_error("the map is too big for the solver");
+
+	// Load the starting state.
+	State initial {};
+	loadMapTiles(initial.board, map);
+	initial.playerX = readMapPlayerX(map);
+	initial.playerY = readMapPlayerY(map);
+	initial.hash = zobrist.hash(initial.board, initial.playerX, initial.playerY);
+
+	result.stateCount = 1;
+
+	// A map without any off buttons is won before the first move.
+	if(initial.board.areAllButtonsOn())
+	{
+		result.solvable = true;
+		return result;
+	}
+
+	unsigned tableBits = std::min(initialTableBits, this->options.tableBits);
+
+	// Search with an ever larger bound on the number of moves,
+	// starting from the lowest that could possibly work.
+	for(std::size_t bound = initial.board.estimateMovesLeft(initial.playerX, initial.playerY);;)
+	{
+		const SearchOutcome outcome = this->search(initial, bound, tableBits, result);
+
+		switch(outcome.type)
+		{
+			case SearchOutcome::Type::Solved:
+				return result;
+
+			case SearchOutcome::Type::Exhausted:
+				// Nothing was cut off by the bound,
+				// so every reachable state has been seen.
+				if(outcome.nextBound == 0)
+					return result;
+
+				bound = outcome.nextBound;
+				break;
+
+			case SearchOutcome::Type::TableFull:
+				// Try again with a bigger table.
+				if(tableBits >= this->options.tableBits)
+					throw std::length_error("transposition table is full, use a larger --table-bits");
+
+				++tableBits;
+				break;
+		}
+	}
+}
+
+Solver::SearchOutcome Solver::search(const State & initial, std::size_t bound, unsigned tableBits, SolverResult & result) const
+{
+	TranspositionTable table { tableBits };
+	table.insert(initial.hash);
+
+	// links[layer][index] records how state 'index' of layer (layer + 1) was reached.
+	std::vector<std::vector<Link>> links;
+	std::vector<State> frontier { initial };
+
+	// The solution is the winning move with the lowest (parent, direction),
+	// which makes the choice independent of which thread found it first.
+	constexpr Link noSolution { std::numeric_limits<std::uint32_t>::max(), 0 };
+
+	// The lowest estimate of any state that was cut off by the bound.
+	std::size_t nextBound = 0;
+
+	// States are only kept if they could lead to a win within 'bound' moves.
+	for(std::size_t moves = 1; !frontier.empty(); ++moves)
+	{
+		const std::size_t chunkCount = ((frontier.size() + chunkSize - 1) / chunkSize);
+
+		std::vector<ChunkOutput> outputs(chunkCount);
+		std::atomic<std::size_t> nextChunk { 0 };
+
+		std::mutex mutex;
+		Link solution = noSolution;
+		bool tableFull = false;
+		std::exception_ptr error;
+
+		const auto expand = [&](std::size_t index, ChunkOutput & output)
+		{
+			const auto & state = frontier[index];
+			const auto & board = state.board;
+
+			const auto fromIndex = BitBoard::getIndex(state.playerX, state.playerY);
+
+			for(std::uint8_t direction = 0; direction < 4; ++direction)
+			{
+				const int x = (state.playerX + directions[direction].x);
+				const int y = (state.playerY + directions[direction].y);
+
+				// The player is kept within the edges of the board.
+				// (The game keeps them within the edges of the map instead,
+				// but any cells between the two are empty and would be a fall.)
+				if((x < static_cast<int>(board.getLeftEdge())) || (x > static_cast<int>(board.getRightEdge())))
+					continue;
+
+				if((y < static_cast<int>(board.getTopEdge())) || (y > static_cast<int>(board.getBottomEdge())))
+					continue;
+
+				State child = state;
+				child.playerX = static_cast<std::uint8_t>(x);
+				child.playerY = static_cast<std::uint8_t>(y);
+
+				// If the player fell, this is a dead end.
+				if(!child.board.move(state.playerX, state.playerY, child.playerX, child.playerY))
+					continue;
+
+				if(child.board.areAllButtonsOn())
+				{
+					const Link link { static_cast<std::uint32_t>(index), direction };
+
+					std::lock_guard<std::mutex> lock { mutex };
+
+					if((link.parent < solution.parent) || ((link.parent == solution.parent) && (link.direction < solution.direction)))
+						solution = link;
+
+					continue;
+				}
+
+				if(child.board.isHopeless(child.playerX, child.playerY))
+					continue;
+
+				// If this state can't be won within the bound,
+				// remember how close it came and move on.
+				const std::size_t estimate = (moves + child.board.estimateMovesLeft(child.playerX, child.playerY));
+
+				if(estimate > bound)
+				{
+					if((output.nextBound == 0) || (estimate < output.nextBound))
+						output.nextBound = estimate;
+
+					continue;
+				}
+
+				const auto toIndex = BitBoard::getIndex(child.playerX, child.playerY);
+				child.hash = zobrist.update(state.hash, board, child.board, fromIndex, toIndex);
+
+				// Only keep states that nobody has reached before.
+				if(table.insert(child.hash))
+				{
+					output.states.push_back(child);
+					output.links.push_back(Link { static_cast<std::uint32_t>(index), direction });
+				}
+			}
+		};
+
+		const auto worker = [&]()
+		{
+			try
+			{
+				for(;;)
+				{
+					const std::size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+
+					if(chunk >= chunkCount)
+						break;
+
+					const std::size_t begin = (chunk * chunkSize);
+					const std::size_t end = std::min(begin + chunkSize, frontier.size());
+
+					for(std::size_t index = begin; index < end; ++index)
+						expand(index, outputs[chunk]);
+				}
+			}
+			catch(const TranspositionTable::FullError &)
+			{
+				std::lock_guard<std::mutex> lock { mutex };
+
+				tableFull = true;
+
+				// Make the other threads run out of work.
+				nextChunk.store(chunkCount, std::memory_order_relaxed);
+			}
+			catch(...)
+			{
+				std::lock_guard<std::mutex> lock { mutex };
+
+				if(!error)
+					error = std::current_exception();
+
+				nextChunk.store(chunkCount, std::memory_order_relaxed);
+			}
+		};
+
+		// There's no point spinning up more threads than there are chunks.
+		const std::size_t threadCount = std::min<std::size_t>(this->options.threadCount, chunkCount);
+
+		std::vector<std::thread> threads;
+
+		for(std::size_t index = 1; index < threadCount; ++index)
+			threads.emplace_back(worker);
+
+		// The calling thread does its share too.
+		worker();
+
+		for(auto & thread : threads)
+			thread.join();
+
+		if(error)
+			std::rethrow_exception(error);
+
+		if(tableFull)
+			return SearchOutcome { SearchOutcome::Type::TableFull, 0 };
+
+		result.stateCount = table.getCount();
+
+		if(solution.parent != noSolution.parent)
+		{
+			// Walk back through the layers to recover the moves.
+			std::string solutionMoves { directions[solution.direction].name };
+
+			std::uint32_t parent = solution.parent;
+
+			for(std::size_t layer = links.size(); layer > 0; --layer)
+			{
+				const auto & link = links[layer - 1][parent];
+				solutionMoves.push_back(directions[link.direction].name);
+				parent = link.parent;
+			}
+
+			std::reverse(solutionMoves.begin(), solutionMoves.end());
+
+			result.solvable = true;
+			result.moveCount = solutionMoves.size();
+			result.moves = solutionMoves;
+			return SearchOutcome { SearchOutcome::Type::Solved, 0 };
+		}
+
+		// Gather the next layer.
+		std::vector<State> next;
+		std::vector<Link> nextLinks;
+
+		for(auto & output : outputs)
+		{
+			next.insert(next.end(), output.states.begin(), output.states.end());
+			nextLinks.insert(nextLinks.end(), output.links.begin(), output.links.end());
+
+			if((output.nextBound != 0) && ((nextBound == 0) || (output.nextBound < nextBound)))
+				nextBound = output.nextBound;
+		}
+
+		frontier = std::move(next);
+		links.push_back(std::move(nextLinks));
+	}
+
+	return SearchOutcome { SearchOutcome::Type::Exhausted, nextBound };
+}
\ No newline at end of file
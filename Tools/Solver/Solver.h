@@ -0,0 +1,122 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+#include "Logic/BitBoard.h"
+
+// The outcome of solving a single map.
+struct SolverResult
+{
+	// Whether any sequence of moves turns every button on.
+	bool solvable { false };
+
+	// The length of the shortest solution.
+	// (Only meaningful if 'solvable' is true.)
+	std::size_t moveCount { 0 };
+
+	// One shortest solution, as a string of 'L', 'R', 'U' and 'D'.
+	std::string moves {};
+
+	// The number of distinct states reached by the final search.
+	std::size_t stateCount { 0 };
+};
+
+struct SolverOptions
+{
+	// The number of worker threads. Zero means one per core.
+	unsigned threadCount { 0 };
+
+	// The transposition table is allowed to grow
+	// up to (1 << tableBits) slots of 8 bytes each.
+	unsigned tableBits { 28 };
+};
+
+// An exhaustive breadth-first solver.
+//
+// The search expands one layer (i.e. one move count) at a time,
+// splitting each layer between all of the worker threads.
+// States that have been seen before are pruned via a shared lock-free
+// transposition table keyed on the Zobrist hash of board and player position.
+// Because layers are expanded in order, the first solution found is a shortest one.
+//
+// To keep the number of states down, each search is bounded:
+// a state is dropped if the number of moves taken plus a lower bound on
+// the moves still needed ('BitBoard::estimateMovesLeft') exceeds the bound.
+// The bound starts at the lowest possible value and is raised until
+// either a solution is found or nothing was dropped,
+// in which case the map is unsolvable.
+// (I.e. this is a breadth-first take on iterative-deepening A*.)
+//
+// Moves follow the same rules as 'GameplayState::movePlayer':
+// the player steps off of the old tile and then onto the new tile,
+// with 'BitBoard' providing the 'stepOn'/'stepOff' rules.
+// The game stops the player at the edges of the map (which can be up to 32x32),
+// while the solver only stops them at the edges of its 8x8 board.
+// On a smaller map that's no different, because the cells past the map's edges
+// are empty, so a move onto one is a fall and is never part of a solution.
+class Solver
+{
+public:
+	// A board and player position.
+	struct State
+	{
+		BitBoard board;
+		std::uint64_t hash;
+		std::uint8_t playerX;
+		std::uint8_t playerY;
+	};
+
+private:
+	struct SearchOutcome
+	{
+		enum class Type
+		{
+			// A solution was found.
+			Solved,
+
+			// Every state within the bound was visited.
+			Exhausted,
+
+			// The transposition table ran out of room.
+			TableFull,
+		};
+
+		Type type;
+
+		// The next bound worth trying, or zero if there's nothing left to try.
+		std::size_t nextBound;
+	};
+
+private:
+	SolverOptions options;
+
+public:
+	explicit Solver(SolverOptions options);
+
+	// Solves a map stored in the same format as the maps in 'Levels::levels'.
+	// Throws 'std::runtime_error' if the map doesn't fit on a 'BitBoard'.
+	SolverResult solve(const std::uint8_t * map) const;
+
+private:
+	// Runs one breadth-first search, discarding any state
+	// that can't be won within 'bound' moves.
+	SearchOutcome search(const State & initial, std::size_t bound, unsigned tableBits, SolverResult & result) const;
+};
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+
+// A fixed-size, lock-free set of 64-bit hashes,
+// shared between all of the solver's threads.
+//
+// It's an open-addressed table with linear probing.
+// Slots are claimed with a single compare-and-swap,
+// and since nothing is ever removed, a slot never changes again
+// once it holds a hash, so readers never need a lock either.
+//
+// Only the hash is stored, not the state it came from,
+// so two states whose hashes collide are treated as the same state.
+// With 64-bit Zobrist hashes that's vanishingly unlikely at the
+// sizes the levels reach, and it keeps each entry to 8 bytes.
+class TranspositionTable
+{
+public:
+	// Thrown when the table is too full to continue.
+	class FullError : public std::length_error
+	{
+	public:
+		FullError() :
+			std::length_error("transposition table is full")
+		{
+		}
+	};
+
+private:
+	// Zero marks an empty slot, so a genuine zero hash is remapped.
+	static constexpr std::uint64_t emptySlot = 0;
+	static constexpr std::uint64_t zeroSubstitute = 1;
+
+private:
+	std::size_t mask;
+	std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+	std::atomic<std::size_t> count { 0 };
+
+public:
+	// Creates a table with (1 << sizeBits) slots.
+	explicit TranspositionTable(unsigned sizeBits) :
+		mask { (static_cast<std::size_t>(1) << sizeBits) - 1 },
+		slots { new std::atomic<std::uint64_t>[static_cast<std::size_t>(1) << sizeBits] }
+	{
+		for(std::size_t index = 0; index <= this->mask; ++index)
+			this->slots[index].store(emptySlot, std::memory_order_relaxed);
+	}
+
+	std::size_t getCapacity() const
+	{
+		return (this->mask + 1);
+	}
+
+	std::size_t getCount() const
+	{
+		return this->count.load(std::memory_order_relaxed);
+	}
+
+	// Inserts a hash.
+	// Returns true if the hash was not already present.
+	// Throws 'FullError' if the table is too full to continue.
+	bool insert(std::uint64_t hash)
+	{
+		if(hash == emptySlot)
+			hash = zeroSubstitute;
+
+		// Refuse to go past 7/8ths full, where probe chains get very long.
+		if(this->getCount() >= (this->getCapacity() - (this->getCapacity() / 8)))
+			throw FullError();
+
+		for(std::size_t index = (hash & this->mask);; index = ((index + 1) & this->mask))
+		{
+			auto & slot = this->slots[index];
+
+			std::uint64_t current = slot.load(std::memory_order_relaxed);
+
+			if(current == hash)
+				return false;
+
+			if(current != emptySlot)
+				continue;
+
+			// Try to claim the slot.
+			if(slot.compare_exchange_strong(current, hash, std::memory_order_relaxed))
+			{
+				this->count.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+
+			// Another thread claimed it first.
+			// If it was claimed for this same hash, then this state is taken.
+			if(current == hash)
+				return false;
+		}
+	}
+};
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <cstdint>
+#include <cstddef>
+
+#include "Logic/BitBoard.h"
+
+// Zobrist hashing for a board and player position.
+//
+// Every (plane, cell) pair that can change during play gets a random key,
+// and a state's hash is the exclusive-or of the keys of its set bits.
+// Solid and button masks never change during play,
+// so they don't contribute to the hash.
+class Zobrist
+{
+public:
+	using plane_type = BitBoard::plane_type;
+
+private:
+	static constexpr std::size_t cellCount = BitBoard::cellCount;
+	static constexpr std::size_t stepPlaneCount = BitBoard::stepPlaneCount;
+
+private:
+	std::uint64_t positionKeys[cellCount];
+	std::uint64_t buttonOnKeys[cellCount];
+	std::uint64_t stepKeys[stepPlaneCount][cellCount];
+
+public:
+	// The keys are generated from a fixed seed
+	// so that hashes are the same from run to run.
+	explicit Zobrist(std::uint64_t seed = 0x466C6F6F7246616CULL)
+	{
+		for(std::size_t index = 0; index < cellCount; ++index)
+			this->positionKeys[index] = next(seed);
+
+		for(std::size_t index = 0; index < cellCount; ++index)
+			this->buttonOnKeys[index] = next(seed);
+
+		for(std::size_t plane = 0; plane < stepPlaneCount; ++plane)
+			for(std::size_t index = 0; index < cellCount; ++index)
+				this->stepKeys[plane][index] = next(seed);
+	}
+
+	// Hashes a whole state from scratch.
+	std::uint64_t hash(const BitBoard & board, std::uint8_t playerX, std::uint8_t playerY) const
+	{
+		std::uint64_t result = this->positionKeys[BitBoard::getIndex(playerX, playerY)];
+
+		result ^= hashPlane(this->buttonOnKeys, board.getButtonOnMask());
+
+		for(std::size_t plane = 0; plane < stepPlaneCount; ++plane)
+			result ^= hashPlane(this->stepKeys[plane], board.getStepPlane(plane));
+
+		return result;
+	}
+
+	// Updates a hash after a move.
+	// Only the bits that differ between the two boards are visited,
+	// which for a single move is at most a handful.
+	std::uint64_t update(std::uint64_t hash, const BitBoard & before, const BitBoard & after, std::uint8_t fromIndex, std::uint8_t toIndex) const
+	{
+		hash ^= this->positionKeys[fromIndex];
+		hash ^= this->positionKeys[toIndex];
+
+		hash ^= hashPlane(this->buttonOnKeys, before.getButtonOnMask() ^ after.getButtonOnMask());
+
+		for(std::size_t plane = 0; plane < stepPlaneCount; ++plane)
+			hash ^= hashPlane(this->stepKeys[plane], before.getStepPlane(plane) ^ after.getStepPlane(plane));
+
+		return hash;
+	}
+
+private:
+	static std::uint64_t hashPlane(const std::uint64_t (& keys)[cellCount], plane_type plane)
+	{
+		std::uint64_t result = 0;
+
+		// Visit each set bit, lowest first.
+		while(plane != 0)
+		{
+			result ^= keys[__builtin_ctzll(plane)];
+			plane &= (plane - 1);
+		}
+
+		return result;
+	}
+
+	// SplitMix64, a small and well-distributed generator.
+	static std::uint64_t next(std::uint64_t & state)
+	{
+		std::uint64_t value = (state += 0x9E3779B97F4A7C15ULL);
+		value = ((value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL);
+		value = ((value ^ (value >> 27)) * 0x94D049BB133111EBULL);
+		return (value ^ (value >> 31));
+	}
+};
\ No newline at end of file
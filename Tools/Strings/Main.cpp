@@ -0,0 +1,440 @@
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+// floorfall-stringc
+//
+// Usage:
+//   floorfall-stringc --header HEADER --source SOURCE LANGUAGE=FILE...
+//
+// Reads each language's strings from its FILE (see 'StringEncoder.h' for the format),
+// compresses them all with one dictionary in the format described by 'Strings/StringCodec.h',
+// and writes HEADER, declaring them as a 'StringTable' indexed by language and 'StringId',
+// and SOURCE, defining them.
+// The languages must be given in the order of the 'Language' enum,
+// and every language must have the same strings.
+// Each string is decompressed again and checked before anything is written.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "StringEncoder.h"
+
+namespace
+{
+	constexpr const char * licence =
+		"//\n"
+		"//  Copyright (C) 2021 Pharap (@Pharap)\n"
+		"//\n"
+		"//  Licensed under the Apache License, Version 2.0 (the \"License\");\n"
+		"//  you may not use this file except in compliance with the License.\n"
+		"//  You may obtain a copy of the License at\n"
+		"//\n"
+		"//       http://www.apache.org/licenses/LICENSE-2.0\n"
+		"//\n"
+		"//  Unless required by applicable law or agreed to in writing, software\n"
+		"//  distributed under the License is distributed on an \"AS IS\" BASIS,\n"
+		"//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
+		"//  See the License for the specific language governing permissions and\n"
+		"//  limitations under the License.\n"
+		"//\n";
+
+	[[noreturn]] void usage()
+	{
+		std::fprintf(stderr, "usage: floorfall-stringc --header HEADER --source SOURCE LANGUAGE=FILE...\n");
+		std::exit(2);
+	}
+
+	void writeByte(std::ostream & stream, std::uint8_t value)
+	{
+		stream << "0x" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << static_cast<unsigned>(value) << std::dec;
+	}
+
+	void writeCodes(std::ostream & stream, const std::vector<std::uint8_t> & codes)
+	{
+		stream << "\t\t";
+
+		for(std::size_t index = 0; index < codes.size(); ++index)
+		{
+			if(index > 0)
+				stream << ' ';
+
+			writeByte(stream, codes[index]);
+			stream << ',';
+		}
+
+		stream << '\n';
+	}
+
+	// Writes text as a C++ string literal, for comments.
+	std::string quote(const std::string & text)
+	{
+		std::string result { "\"" };
+
+		for(const char character : text)
+		{
+			if((character == '"') || (character == '\\'))
+				result += '\\';
+
+			result += character;
+		}
+
+		return (result + '"');
+	}
+
+	std::string getFileName(const std::string & path)
+	{
+		const auto slash = path.find_last_of("/\\");
+
+		return (slash == std::string::npos) ? path : path.substr(slash + 1);
+	}
+
+	// One language's strings, as read from its file.
+	struct LanguageStrings
+	{
+		std::string language;
+		std::string path;
+		std::vector<NamedString> strings;
+	};
+
+	// Lists the file names, for the comment at the top of the output.
+	std::string getFileNames(const std::vector<LanguageStrings> & languages)
+	{
+		std::string result;
+
+		for(std::size_t index = 0; index < languages.size(); ++index)
+		{
+			if(index > 0)
+				result += ((index + 1) < languages.size()) ? ", " : " and ";
+
+			result += getFileName(languages[index].path);
+		}
+
+		return result;
+	}
+
+	void writeHeader(std::ostream & stream, const std::vector<LanguageStrings> & languages, const StringTable & table, const std::vector<std::size_t> & offsets, const std::string & offsetType)
+	{
+		const std::vector<NamedString> & names = languages.front().strings;
+
+		stream << "#pragma once\n\n" << licence << '\n';
+		stream << "// Made by floorfall-stringc from " << getFileNames(languages) << ", don't edit this by hand.\n\n";
+		stream << "// For uint8_t, uint16_t\n#include <stdint.h>\n\n// For PROGMEM\n#include <avr/pgmspace.h>\n\n";
+		stream << "#include \"../Language.h\"\n\n";
+
+		stream << "// The strings that every language has.\nenum class StringId : uint8_t\n{\n";
+
+		for(const NamedString & string : names)
+			stream << '\t' << string.name << ",\n";
+
+		stream << "};\n\n";
+		stream << "constexpr uint8_t stringIdCount = " << names.size() << ";\n\n";
+
+		stream << "// Every language's strings, compressed as described by 'StringCodec'.\n";
+		stream << "struct StringTable\n{\n";
+
+		if(table.dictionary.empty())
+		{
+			stream << "\t// None of the pairs of characters are common enough to be worth a code.\n";
+			stream << "\tstatic constexpr const uint8_t * dictionary = nullptr;\n\n";
+		}
+		else
+		{
+			stream << "\t// The pairs that the codes from 0x80 upwards stand for, shared by every language.\n";
+			stream << "\tstatic constexpr uint8_t dictionary[] PROGMEM\n\t{\n";
+
+			for(std::size_t index = 0; index < table.dictionary.size(); index += 2)
+			{
+				const std::vector<std::uint8_t> pair { table.dictionary[index], table.dictionary[index + 1] };
+
+				stream << "\t\t// ";
+				writeByte(stream, static_cast<std::uint8_t>(0x80 + (index / 2)));
+				stream << ' ' << quote(decompressString(table, pair)) << '\n';
+				writeCodes(stream, pair);
+			}
+
+			stream << "\t};\n\n";
+		}
+
+		stream << "\tstatic constexpr uint8_t codes[] PROGMEM\n\t{\n";
+
+		for(std::size_t language = 0; language < languages.size(); ++language)
+			for(std::size_t id = 0; id < names.size(); ++id)
+			{
+				const std::size_t index = ((language * names.size()) + id);
+
+				if(index > 0)
+					stream << '\n';
+
+				stream << "\t\t// " << languages[language].language << ' ' << names[id].name << ' ' << quote(languages[language].strings[id].text) << '\n';
+				writeCodes(stream, table.strings[index]);
+			}
+
+		stream << "\t};\n\n";
+
+		stream << "\t// Where each string's codes start in 'codes', language by language,\n";
+		stream << "\t// followed by where the last language's last string ends.\n";
+		stream << "\t// (So a string's codes end where the next string's start.)\n";
+		stream << "\tstatic constexpr " << offsetType << " offsets[] PROGMEM\n\t{\n";
+
+		for(std::size_t language = 0; language < languages.size(); ++language)
+		{
+			stream << "\t\t// " << languages[language].language << "\n\t\t";
+
+			for(std::size_t id = 0; id < names.size(); ++id)
+			{
+				if(id > 0)
+					stream << ' ';
+
+				stream << offsets[(language * names.size()) + id] << ',';
+			}
+
+			stream << "\n\n";
+		}
+
+		stream << "\t\t// The end\n\t\t" << offsets.back() << ",\n";
+		stream << "\t};\n";
+		stream << "};\n\n";
+
+		stream << "// The table holds the languages in the same order as 'Language'.\n";
+		stream << "static_assert(languageCount == " << languages.size() << ", \"The string table doesn't have every language\");\n";
+
+		for(std::size_t language = 0; language < languages.size(); ++language)
+		{
+			stream << "static_assert(static_cast<uint8_t>(Language::" << languages[language].language << ") == " << language << ", \"The string table's languages are in the wrong order\");";
+
+			if((language + 1) < languages.size())
+				stream << '\n';
+		}
+	}
+
+	void writeSource(std::ostream & stream, const std::vector<LanguageStrings> & languages, const std::string & headerPath, const StringTable & table, const std::string & offsetType)
+	{
+		stream << "#include \"" << getFileName(headerPath) << "\"\n\n" << licence << '\n';
+		stream << "// Made by floorfall-stringc from " << getFileNames(languages) << ", don't edit this by hand.\n\n";
+		stream << "// Unfortunately it's necessary to 'define' these here\n";
+		stream << "// despite this not actually providing the compiler with\n";
+		stream << "// any information that it didn't have before.\n\n";
+		stream << "// It's due to an unfortunate side effect of the\n";
+		stream << "// header-source split model that C++ inherited from C.\n";
+		stream << "// C++17 fixed this annoying discrepency by introducing 'inline' variables.\n";
+		stream << "// But Arduino-land only supports C++11, not C++17.\n\n";
+
+		if(table.dictionary.empty())
+			stream << "constexpr const uint8_t * StringTable::dictionary;\n";
+		else
+			stream << "constexpr uint8_t StringTable::dictionary[];\n";
+
+		stream << "constexpr uint8_t StringTable::codes[];\n";
+		stream << "constexpr " << offsetType << " StringTable::offsets[];";
+	}
+
+	void writeFile(const std::string & path, const std::string & text)
+	{
+		// The game's sources use Windows line endings,
+		// so the output should too.
+		std::ofstream output { path, std::ios::binary };
+
+		for(const char character : text)
+		{
+			if(character == '\n')
+				output << '\r';
+
+			output << character;
+		}
+
+		if(!output)
+			throw std::runtime_error("can't write " + path);
+	}
+
+	LanguageStrings readLanguage(const std::string & argument)
+	{
+		const auto equals = argument.find('=');
+
+		if((equals == std::string::npos) || (equals == 0) || ((equals + 1) == argument.size()))
+			usage();
+
+		LanguageStrings result { argument.substr(0, equals), argument.substr(equals + 1), {} };
+
+		std::ifstream file { result.path };
+
+		if(!file)
+			throw std::runtime_error("can't open " + result.path);
+
+		result.strings = parseStrings(file, result.path);
+
+		if(result.strings.empty())
+			throw std::runtime_error(result.path + " has no strings");
+
+		return result;
+	}
+
+	// Puts a language's strings in the same order as the first language's,
+	// making sure that it has all of them and nothing else.
+	void matchStrings(LanguageStrings & language, const std::vector<NamedString> & names)
+	{
+		std::map<std::string, std::string> texts;
+
+		for(NamedString & string : language.strings)
+			texts[string.name] = std::move(string.text);
+
+		std::vector<NamedString> result;
+
+		for(const NamedString & name : names)
+		{
+			const auto iterator = texts.find(name.name);
+
+			if(iterator == texts.end())
+				throw std::runtime_error(language.path + " has no string called " + name.name);
+
+			result.push_back(NamedString { name.name, std::move(iterator->second) });
+			texts.erase(iterator);
+		}
+
+		if(!texts.empty())
+			throw std::runtime_error(language.path + " has a string called " + texts.begin()->first + ", which the other languages don't");
+
+		language.strings = std::move(result);
+	}
+
+	// The bytes that a table of codes, its dictionary and its offsets take up in the game.
+	std::size_t getTableSize(const StringTable & table)
+	{
+		std::size_t codeCount = 0;
+
+		for(const std::vector<std::uint8_t> & codes : table.strings)
+			codeCount += codes.size();
+
+		// There's an offset for each string, and one for the end.
+		const std::size_t offsetSize = (codeCount > 0xFF) ? 2 : 1;
+
+		return (table.dictionary.size() + codeCount + ((table.strings.size() + 1) * offsetSize));
+	}
+}
+
+int main(int argumentCount, char * arguments[])
+{
+	std::string headerPath;
+	std::string sourcePath;
+	std::vector<std::string> languageArguments;
+
+	for(int index = 1; index < argumentCount; ++index)
+	{
+		const std::string argument { arguments[index] };
+
+		if((argument == "--header") || (argument == "--source"))
+		{
+			if((index + 1) >= argumentCount)
+				usage();
+
+			const std::string value { arguments[++index] };
+
+			if(argument == "--header")
+				headerPath = value;
+			else
+				sourcePath = value;
+		}
+		else if(!argument.empty() && (argument[0] != '-'))
+		{
+			languageArguments.push_back(argument);
+		}
+		else
+		{
+			usage();
+		}
+	}
+
+	if(headerPath.empty() || sourcePath.empty() || languageArguments.empty())
+		usage();
+
+	try
+	{
+		std::vector<LanguageStrings> languages;
+
+		for(const std::string & argument : languageArguments)
+			languages.push_back(readLanguage(argument));
+
+		for(std::size_t index = 1; index < languages.size(); ++index)
+			matchStrings(languages[index], languages.front().strings);
+
+		// Every language is compressed together, so they share one dictionary.
+		std::vector<NamedString> strings;
+
+		for(const LanguageStrings & language : languages)
+			strings.insert(strings.end(), language.strings.begin(), language.strings.end());
+
+		const StringTable table = compressStrings(strings);
+
+		// Make sure the game will print exactly what's in the files.
+		std::vector<std::size_t> offsets { 0 };
+
+		for(std::size_t index = 0; index < strings.size(); ++index)
+		{
+			if(table.strings[index].size() > 0xFF)
+				throw std::runtime_error(strings[index].name + " is too long");
+
+			if(decompressString(table, table.strings[index]) != strings[index].text)
+				throw std::runtime_error(strings[index].name + " doesn't survive being compressed");
+
+			offsets.push_back(offsets.back() + table.strings[index].size());
+		}
+
+		if(offsets.back() > 0xFFFF)
+			throw std::runtime_error("there's too much text");
+
+		// The offsets only need to be as big as the codes.
+		const std::string offsetType = (offsets.back() > 0xFF) ? "uint16_t" : "uint8_t";
+
+		// Sharing a table is only worth it if it's smaller than the tables
+		// that building the game for each language on its own would need between them.
+		const std::size_t sharedSize = getTableSize(table);
+
+		std::size_t separateSize = 0;
+
+		for(const LanguageStrings & language : languages)
+			separateSize += getTableSize(compressStrings(language.strings));
+
+		if((languages.size() > 1) && (sharedSize >= separateSize))
+			throw std::runtime_error("the shared table takes " + std::to_string(sharedSize) + " bytes, but building each language separately would only take " + std::to_string(separateSize));
+
+		std::ostringstream header;
+		writeHeader(header, languages, table, offsets, offsetType);
+
+		std::ostringstream source;
+		writeSource(source, languages, headerPath, table, offsetType);
+
+		writeFile(headerPath, header.str());
+		writeFile(sourcePath, source.str());
+
+		std::fprintf(stderr, "floorfall-stringc: %zu bytes for %zu languages, instead of %zu built separately\n", sharedSize, languages.size(), separateSize);
+	}
+	catch(const std::exception & exception)
+	{
+		std::fprintf(stderr, "floorfall-stringc: %s\n", exception.what());
+		return 2;
+	}
+
+	return 0;
+}
\ No newline at end of file
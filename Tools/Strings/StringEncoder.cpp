@@ -0,0 +1,234 @@
+#include "StringEncoder.h"
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include "Strings/StringCodec.h"
+
+namespace
+{
+	using Pair = std::pair<std::uint8_t, std::uint8_t>;
+
+	// Reads the text between a pair of double quotes, starting just after the opening one.
+	std::string readQuoted(const std::string & line, std::size_t & position, const std::string & where)
+	{
+		std::string text;
+
+		while(position < line.size())
+		{
+			const char character = line[position++];
+
+			if(character == '"')
+				return text;
+
+			if(character == '\\')
+			{
+				if(position >= line.size())
+					break;
+
+				const char escaped = line[position++];
+
+				if((escaped != '"') && (escaped != '\\'))
+					throw std::runtime_error(where + ": unknown escape '\\" + escaped + "'");
+
+				text += escaped;
+				continue;
+			}
+
+			if((character < ' ') || (character > '~'))
+				throw std::runtime_error(where + ": only printable ASCII characters can be used");
+
+			text += character;
+		}
+
+		throw std::runtime_error(where + ": the string has no closing quote");
+	}
+
+	// Counts the places each pair could be replaced,
+	// without counting overlapping pairs (as in "aaa") twice.
+	std::map<Pair, std::size_t> countPairs(const std::vector<std::vector<std::uint8_t>> & strings)
+	{
+		std::map<Pair, std::size_t> counts;
+
+		for(const auto & codes : strings)
+		{
+			std::map<Pair, std::size_t> lastEnds;
+
+			for(std::size_t index = 1; index < codes.size(); ++index)
+			{
+				const Pair pair { codes[index - 1], codes[index] };
+
+				const auto last = lastEnds.find(pair);
+
+				if((last != lastEnds.end()) && (last->second == (index - 1)))
+					continue;
+
+				lastEnds[pair] = index;
+				++counts[pair];
+			}
+		}
+
+		return counts;
+	}
+
+	void replacePair(std::vector<std::uint8_t> & codes, const Pair & pair, std::uint8_t code)
+	{
+		std::vector<std::uint8_t> result;
+
+		for(std::size_t index = 0; index < codes.size(); ++index)
+		{
+			if(((index + 1) < codes.size()) && (codes[index] == pair.first) && (codes[index + 1] == pair.second))
+			{
+				result.push_back(code);
+				++index;
+			}
+			else
+			{
+				result.push_back(codes[index]);
+			}
+		}
+
+		codes = std::move(result);
+	}
+
+	void decodeCode(const StringTable & table, std::uint8_t code, std::string & text)
+	{
+		if(code < StringCodec::firstPairCode)
+		{
+			text += static_cast<char>(code);
+			return;
+		}
+
+		const std::size_t index = ((code - StringCodec::firstPairCode) * 2);
+
+		if((index + 1) >= table.dictionary.size())
+			throw std::runtime_error("a code has no pair in the dictionary");
+
+		decodeCode(table, table.dictionary[index + 0], text);
+		decodeCode(table, table.dictionary[index + 1], text);
+	}
+}
+
+std::vector<NamedString> parseStrings(std::istream & stream, const std::string & path)
+{
+	std::vector<NamedString> strings;
+	std::set<std::string> names;
+
+	std::string line;
+	std::size_t lineNumber = 0;
+
+	while(std::getline(stream, line))
+	{
+		++lineNumber;
+
+		const std::string where = (path + ":" + std::to_string(lineNumber));
+
+		// Tolerate Windows line endings.
+		if(!line.empty() && (line.back() == '\r'))
+			line.pop_back();
+
+		std::size_t position = line.find_first_not_of(" \t");
+
+		if((position == std::string::npos) || (line.compare(position, 2, "//") == 0))
+			continue;
+
+		const std::size_t nameEnd = line.find_first_of(" \t", position);
+
+		if(nameEnd == std::string::npos)
+			throw std::runtime_error(where + ": expected a name and then a string");
+
+		const std::string name = line.substr(position, nameEnd - position);
+
+		position = line.find_first_not_of(" \t", nameEnd);
+
+		if((position == std::string::npos) || (line[position] != '"'))
+			throw std::runtime_error(where + ": expected a string in double quotes");
+
+		++position;
+
+		std::string text = readQuoted(line, position, where);
+
+		if(line.find_first_not_of(" \t", position) != std::string::npos)
+			throw std::runtime_error(where + ": unexpected text after the string");
+
+		if(!names.insert(name).second)
+			throw std::runtime_error(where + ": there's already a string called " + name);
+
+		strings.push_back(NamedString { name, std::move(text) });
+	}
+
+	return strings;
+}
+
+StringTable compressStrings(const std::vector<NamedString> & strings)
+{
+	StringTable table;
+
+	for(const auto & string : strings)
+		table.strings.emplace_back(string.text.begin(), string.text.end());
+
+	// The depth of each code: 0 for characters, more for pairs.
+	std::vector<std::uint8_t> depths(0x100, 0);
+
+	for(std::size_t code = StringCodec::firstPairCode; code < 0x100; ++code)
+	{
+		// Find the most common pair that isn't nested too deeply.
+		// (Ties go to the smallest pair, so the output is always the same.)
+		Pair best {};
+		std::size_t bestCount = 0;
+
+		for(const auto & entry : countPairs(table.strings))
+		{
+			const std::uint8_t depth = (1 + std::max(depths[entry.first.first], depths[entry.first.second]));
+
+			if((depth <= StringCodec::maximumDepth) && (entry.second > bestCount))
+			{
+				best = entry.first;
+				bestCount = entry.second;
+			}
+		}
+
+		// A pair costs two bytes of dictionary and saves a byte each time it's used,
+		// so it has to be used at least three times to be worth it.
+		if(bestCount < 3)
+			break;
+
+		table.dictionary.push_back(best.first);
+		table.dictionary.push_back(best.second);
+		depths[code] = (1 + std::max(depths[best.first], depths[best.second]));
+
+		for(auto & codes : table.strings)
+			replacePair(codes, best, static_cast<std::uint8_t>(code));
+	}
+
+	return table;
+}
+
+std::string decompressString(const StringTable & table, const std::vector<std::uint8_t> & codes)
+{
+	std::string text;
+
+	for(const std::uint8_t code : codes)
+		decodeCode(table, code, text);
+
+	return text;
+}
\ No newline at end of file
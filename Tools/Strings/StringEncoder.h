@@ -0,0 +1,59 @@
+#pragma once
+
+//
+//  Copyright (C) 2021 Pharap (@Pharap)
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+// A string to be compressed, and the name it's given in the game.
+struct NamedString
+{
+	std::string name;
+	std::string text;
+};
+
+// Reads a list of strings, one per line, each a name followed by its text in double quotes:
+//
+//   PressA "Press A"
+//   Par " Par "
+//
+// Within the quotes, '\"' is a double quote and '\\' is a backslash.
+// Blank lines and lines starting with '//' are skipped.
+// 'path' is only used in error messages.
+//
+// Throws 'std::runtime_error' if a line is malformed, a name is used twice,
+// or a string has a character outside of printable ASCII.
+std::vector<NamedString> parseStrings(std::istream & stream, const std::string & path);
+
+// Strings compressed in the format described by 'Strings/StringCodec.h'.
+struct StringTable
+{
+	// Two codes for each pair, the first pair standing for 'StringCodec::firstPairCode'.
+	std::vector<std::uint8_t> dictionary;
+
+	// The codes of each string, in the order they were given.
+	std::vector<std::vector<std::uint8_t>> strings;
+};
+
+// Compresses strings with byte pair encoding, sharing one dictionary between them all.
+StringTable compressStrings(const std::vector<NamedString> & strings);
+
+// Decodes one of the strings of a table, as 'CompressedFlashString' would.
+std::string decompressString(const StringTable & table, const std::vector<std::uint8_t> & codes);
\ No newline at end of file